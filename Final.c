@@ -40,6 +40,7 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/debug.h"
+#include "driverlib/cpu.h"
 #include "utils/ustdlib.h"
 #include "circBufT.h"
 #include "OrbitOLED/OrbitOLEDInterface.h"
@@ -52,6 +53,11 @@
 #include "controlLoop.h"
 #include "switches.h"
 #include "flightStates.h"
+#include "inputEvents.h"
+#include "eventQueue.h"
+#include "freqSweep.h"
+#include "gainSchedule.h"
+#include "trajectory.h"
 
 //*****************************************************************************
 //
@@ -64,7 +70,7 @@
 #define QUANTISATION12BIT 4095 // 2 ^ 12 - 1
 #define ONEVOLTAGEDROP (QUANTISATION12BIT) / 4 * 1.2 // Change in number of bits for one volt
 #define CALIBRATION_TICK_RATE_HZ 4
-#define N_TASKS 7
+#define N_TASKS 6
 #define ALT_STEP 10
 #define YAW_STEP 15
 #define INIT_ADC_BUFFER_WAIT 500
@@ -82,6 +88,14 @@
 
 static uint32_t g_ulSampCnt;    // Counter for the interrupts
 static uint8_t g_taskCount = 0; // Counter for scheduler
+static uint32_t g_idleCycles = 0;  // Clock cycles spent asleep since the last UART report
+static uint32_t g_idleStart;       // inputTime() at the last UART report
+static uint8_t g_idlePercent = 0;  // Share of the last UART period spent asleep
+static char g_command[MAX_CMD_LEN + 1]; // Command line being received over UART
+static uint32_t g_mainApplied = 0; // Main duty the PWM layer applied last control tick, tenths of a percent
+static uint32_t g_tailApplied = 0; // Tail duty the PWM layer applied last control tick, tenths of a percent
+static trajectory_t g_altTrajectory = {0, 0, TRAJ_ALT_MAX_RATE, TRAJ_ALT_MAX_ACCEL, 0};    // Altitude reference followed by the main rotor
+static trajectory_t g_yawTrajectory = {0, 0, TRAJ_YAW_MAX_RATE, TRAJ_YAW_MAX_ACCEL, 360};  // Yaw reference followed by the tail rotor
 
 // Structure to hold the scheduled tasks
 static struct scheduled_task {
@@ -91,13 +105,203 @@ static struct scheduled_task {
 };
 
 // Enumerate type for iterating in the SysTickIntHandler
-static enum tasks{uart = 0, disp, adc,pwm,buttons,switches,calibration};
+static enum tasks{uart = 0, disp, calibration,chart,landing,sweep};
 
 // Instance of the scheduled task structure with correct size for the number of tasks
 static struct scheduled_task scheduledTasks[N_TASKS];
 
 static char* currentStateCharArray[] = {"Calibrating ADC","Waiting for Switch","Calibrating Altitude","Calibrating Yaw","Landing","Landed","Flying"};
 
+//*****************************************************************************
+//
+// Returns true if a set point button has been pushed or has auto-repeated
+// since it was last checked, so holding it steps the set point repeatedly
+//
+//*****************************************************************************
+static bool
+buttonStep (uint8_t butName)
+{
+    const uint8_t butState = checkButton (butName);
+    return (butState == PUSHED) || (butState == REPEATED);
+}
+
+//*****************************************************************************
+//
+// Returns true if any scheduled task is waiting to run. Called with interrupts
+// disabled before sleeping, so a task made ready after the check wakes the
+// processor straight away.
+//
+//*****************************************************************************
+static bool
+tasksReady (void)
+{
+    uint8_t task;
+
+    for (task = 0; task < N_TASKS; task++) {
+        if (scheduledTasks[task].ready) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//*****************************************************************************
+//
+// Sleep until the next interrupt if no event or task is waiting, adding the
+// time asleep to g_idleCycles. Interrupts are masked over the check so one
+// arriving after it still ends the WFI, and is taken once they are unmasked.
+// SysTick keeps counting while the processor sleeps and always wakes it
+// within one period, so the time asleep is the fall in the SysTick counter,
+// allowing for one reload.
+//
+//*****************************************************************************
+static void
+idleSleep (void)
+{
+    uint32_t before;
+    uint32_t after;
+
+    IntMasterDisable();
+    if (!eventPending() && !g_adcBlockReady && !tasksReady()) {
+        before = SysTickValueGet();
+        CPUwfi();
+        after = SysTickValueGet();
+        if (after > before) {
+            before += SysTickPeriodGet();
+        }
+        g_idleCycles += before - after;
+    }
+    IntMasterEnable();
+}
+
+//*****************************************************************************
+//
+// Works out the share of time spent asleep since the last call
+//
+//*****************************************************************************
+static void
+updateIdlePercent (void)
+{
+    const uint32_t now = inputTime();
+    const uint32_t window = (now - g_idleStart) * SysTickPeriodGet();
+
+    if (window >= 100) {
+        g_idlePercent = g_idleCycles / (window / 100);
+    }
+    g_idleCycles = 0;
+    g_idleStart = now;
+}
+
+//*****************************************************************************
+//
+// Carries out a command line received over UART and replies OK or ERR:
+//   FM <Hz>      set the main rotor PWM frequency
+//   FT <Hz>      set the tail rotor PWM frequency
+//   SM <0.1%/s>  set the main rotor slew limit, 0 for none
+//   ST <0.1%/s>  set the tail rotor slew limit, 0 for none
+//   SWEEP <%>    while flying, sweep the main rotor frequency at a fixed duty
+//   STOP         end a sweep
+//
+//*****************************************************************************
+static void
+runCommand (const char *command)
+{
+    uint32_t value;
+    bool ok = false;
+
+    if (ustrncasecmp (command, "FM ", 3) == 0) {
+        ok = setMainPWMFreq (ustrtoul (command + 3, 0, 10));
+    } else if (ustrncasecmp (command, "FT ", 3) == 0) {
+        ok = setTailPWMFreq (ustrtoul (command + 3, 0, 10));
+    } else if (ustrncasecmp (command, "SM ", 3) == 0) {
+        setMainPWMSlew (ustrtoul (command + 3, 0, 10));
+        ok = true;
+    } else if (ustrncasecmp (command, "ST ", 3) == 0) {
+        setTailPWMSlew (ustrtoul (command + 3, 0, 10));
+        ok = true;
+    } else if (ustrncasecmp (command, "SWEEP ", 6) == 0) {
+        value = ustrtoul (command + 6, 0, 10);
+        if ((currentState == FLYING) && (value >= PWM_MIN_DUTY) && (value <= PWM_MAX_DUTY_MAIN)) {
+            startSweep (value);
+            ok = true;
+        }
+    } else if (ustrcasecmp (command, "STOP") == 0) {
+        stopSweep ();
+        ok = true;
+    }
+
+    UARTSend (ok ? "OK\r\n" : "ERR\r\n");
+}
+
+//*****************************************************************************
+//
+// Control stage, run from SysTick. The flight state only overrides the set
+// points going into the controllers and the duty cycles coming out of them;
+// the duty cycles are then written to the motors in the same tick and loaded
+// at the start of the next PWM cycle. The controllers follow profiled
+// references that move smoothly towards the set points.
+//
+//*****************************************************************************
+static void
+controlStep (void)
+{
+    const double dt = (double) 1/SYSTICK_RATE_HZ;
+    double altReference;
+    double yawReference;
+    uint32_t mainDuty;
+    uint32_t tailDuty;
+
+    // Set point overrides
+    if (currentState == LANDED) {
+        g_setPointAlt = 0;
+    }
+
+    // While the motors are off, or the yaw is still being found, the
+    // references sit on the measurements so the next move starts from rest
+    if ((currentState == WAITING_ON_SWITCH) || (currentState == LANDED)) {
+        trajectoryReset (&g_altTrajectory, g_percentAltitude);
+    }
+    if ((currentState == WAITING_ON_SWITCH) || (currentState == LANDED) || (currentState == CALIBRATE_YAW)) {
+        trajectoryReset (&g_yawTrajectory, g_currentAngle);
+    }
+    altReference = trajectoryStep (&g_altTrajectory, g_setPointAlt, dt);
+    yawReference = trajectoryStep (&g_yawTrajectory, g_setPointYaw, dt);
+
+    scheduleAltitudeGains(g_percentAltitude);
+    g_controlAltitude = pidUpdateMain(altReference, g_percentAltitude, g_mainApplied, g_pGainAltitude,g_iGainAltitude,g_dGainAltitude,dt);
+    g_controlYaw = pidUpdateTail(yawReference, g_currentAngle, g_mainApplied, g_tailApplied, g_pGainYaw,g_iGainYaw,g_dGainYaw,dt);
+
+    // Output overrides
+    switch (currentState) {
+        case CALIBRATE_ALT:
+        case LANDING:
+            mainDuty = g_controlAltitude;
+            tailDuty = g_controlYaw;
+            break;
+        case FLYING:
+            mainDuty = g_controlAltitude;
+            tailDuty = g_controlYaw;
+            if (sweepActive()) {
+                mainDuty = sweepDutyPermille();
+            }
+            break;
+        case CALIBRATE_YAW:
+            mainDuty = g_controlAltitude;
+            tailDuty = YAW_CALIBRATION_TAIL_PWM * PWM_PERMILLE_PER_PERCENT;
+            break;
+        case LANDED:
+            mainDuty = 0;
+            tailDuty = 0;
+            break;
+        default:
+            return; // Motors stay as they are until the switch is first raised
+    }
+
+    g_mainApplied = setMainPWMPermille (mainDuty);
+    g_tailApplied = setTailPWMPermille (tailDuty);
+    syncPWM ();
+}
+
 //*****************************************************************************
 //
 // The interrupt handler for the for SysTick interrupt
@@ -121,18 +325,13 @@ SysTickIntHandler(void)
     ADCProcessorTrigger(ADC0_BASE, 3);
     g_ulSampCnt++;
 
+    // Time base for the button and switch edge timestamps
+    inputTick();
+
     //Control calculations which are inside SysTick for constant dt
     if(currentState != CALIBRATE_ADC){
-        g_controlAltitude = pidUpdateMain(g_setPointAlt, g_percentAltitude,g_pGainAltitude,g_iGainAltitude,g_dGainAltitude,(double) 1/SYSTICK_RATE_HZ);
-        g_controlYaw = pidUpdateTail(g_setPointYaw, g_currentAngle, g_controlAltitude, g_pGainYaw,g_iGainYaw,g_dGainYaw,(double) 1/SYSTICK_RATE_HZ);
-    }
-
-    // Check to see if calibration is complete and set to next mode if true
-    if ((g_yawCalibrationFlag == true) && (currentState == CALIBRATE_YAW)){
-        currentState = FLYING;
+        controlStep();
     }
-
-
 }
 
 //*****************************************************************************
@@ -177,26 +376,22 @@ initTasks (void)
     scheduledTasks[disp].ready = false;
     scheduledTasks[disp].period = SYSTICK_RATE_HZ / DISP_TICK_RATE_HZ;
 
-    scheduledTasks[adc].delay = 0;
-    scheduledTasks[adc].ready = true;
-    scheduledTasks[adc].period = SYSTICK_RATE_HZ / ALT_TICK_RATE_HZ;
-
-    scheduledTasks[pwm].delay = 0;
-    scheduledTasks[pwm].ready = false;
-    scheduledTasks[pwm].period = SYSTICK_RATE_HZ / ALT_TICK_RATE_HZ;
-
-    scheduledTasks[buttons].delay = 0;
-    scheduledTasks[buttons].ready = false;
-    scheduledTasks[buttons].period = SYSTICK_RATE_HZ / BUTTON_TICK_RATE_HZ;
-
-    scheduledTasks[switches].delay = 0;
-    scheduledTasks[switches].ready = false;
-    scheduledTasks[switches].period = SYSTICK_RATE_HZ / SWITCH_TICK_RATE_HZ;
-
     scheduledTasks[calibration].delay = 0;
     scheduledTasks[calibration].ready = false;
     scheduledTasks[calibration].period = SYSTICK_RATE_HZ / CALIBRATION_TICK_RATE_HZ;
 
+    scheduledTasks[chart].delay = 0;
+    scheduledTasks[chart].ready = false;
+    scheduledTasks[chart].period = SYSTICK_RATE_HZ / CHART_TICK_RATE_HZ;
+
+    scheduledTasks[landing].delay = 0;
+    scheduledTasks[landing].ready = false;
+    scheduledTasks[landing].period = SYSTICK_RATE_HZ / ALT_TICK_RATE_HZ;
+
+    scheduledTasks[sweep].delay = 0;
+    scheduledTasks[sweep].ready = false;
+    scheduledTasks[sweep].period = SYSTICK_RATE_HZ / SWEEP_TICK_RATE_HZ;
+
 }
 
 
@@ -209,8 +404,6 @@ main(void)
     int32_t mean = 0;
     int32_t ADCHeliLandedVoltage;
     int32_t ADCHeliMinVoltage;
-    uint32_t ui32MainFreq = PWM_START_RATE_HZ; // Setting start Freq for PWM gen
-    uint32_t ui32TailFreq = PWM_START_RATE_HZ;
 
     // As a precaution, make sure that the peripherals used are reset
     SysCtlPeripheralReset (PWM_MAIN_PERIPH_GPIO);
@@ -223,6 +416,7 @@ main(void)
 
     //Initialization
     initTasks();
+    initEventQueue ();
     initClock ();
     initGPIO();
     initADC ();
@@ -232,6 +426,8 @@ main(void)
     initCircBuf (&g_inBuffer, BUF_SIZE);
     initButtons ();
     initSwitch ();
+    initInputEvents ();
+    initGainSchedule ();
 
     // Initialisation is complete, so turn on the output.
     PWMOutputState(PWM_MAIN_BASE, PWM_MAIN_OUTBIT, true);
@@ -242,55 +438,116 @@ main(void)
 
     while (1)
     {
-        // Switches task
-        if (scheduledTasks[switches].ready){
-            scheduledTasks[switches].ready = false;
-            updateSwitch();
-            const uint8_t switchState = checkSwitch();
-            switch (currentState) {
-                case FLYING:
-                    if (switchState == SWITCH_DOWN) {
-                        currentState = LANDING;
-                        g_errorIntMain = 0;
-                        g_errorIntTail = 0;
+        // Event task
+        // Everything the interrupt handlers have seen since the last pass, in
+        // the order it happened
+        event_t event;
+        while (readEvent (&event)) {
+            switch (event.type) {
+                case EVENT_YAW_REF:
+                    // The first pass of the reference finishes yaw calibration
+                    if (g_yawCalibrationFlag == false) {
+                        g_pidTail.integral = 0;
+                        g_yawCalibrationFlag = true;
+                        g_setPointYaw = 0;
                     }
                     break;
-                case LANDED:
-                    if (switchState == SWITCH_UP) {
-                        currentState = FLYING;
-                        g_errorIntMain = 0;
-                        g_errorIntTail = 0;
-                    }
+                case EVENT_BUTTON:
+                    buttonEdge (event.input, event.time);
+                    break;
+                case EVENT_SWITCH:
+                    switchEdge (event.level, event.time);
                     break;
-                case WAITING_ON_SWITCH:
-                    if (switchState == SWITCH_UP) {
-                        currentState = CALIBRATE_ALT;
-                    }
             }
         }
 
-        // Button task
-        if ((scheduledTasks[buttons].ready && (currentState != CALIBRATE_ADC) && (currentState == FLYING) && (currentState != CALIBRATE_YAW) && (currentState != CALIBRATE_ALT))){
-           scheduledTasks[buttons].ready = false;
+        // Altitude task
+        // Code obtained from ADCDemo.c from Lab 3
+        // Calculate the (approximate) mean of the values in the circular
+        // buffer and the altitude from it once a new block of samples is in.
+        // Blocks that arrive while the loop is busy are taken together.
+        if (g_adcBlockReady) {
+            int32_t sum = 0;
+            g_adcBlockReady = false;
+            for (i = 0; i < BUF_SIZE; i++){
+                sum = sum + readCircBuf (&g_inBuffer);
+            }
+
+            mean = ((2 * sum + BUF_SIZE) / 2 / BUF_SIZE); // Mean calculation code from the lecture
+
+            if((currentState == CALIBRATE_ADC)){
+
+                if (((mean != 0) && (g_ulSampCnt > (INIT_ADC_BUFFER_WAIT)))) {
+                    ADCHeliLandedVoltage = mean;
+                    ADCHeliMinVoltage = ADCHeliLandedVoltage - ONEVOLTAGEDROP;
+                    currentState = WAITING_ON_SWITCH;
+                }
+            }
+
+            // Calculate the percentage altitude accounting for int division
+            g_percentAltitude = (MAX_PERCENT_ALT -  ((mean - ADCHeliMinVoltage) * MAX_PERCENT_ALT) / (ADCHeliLandedVoltage - ADCHeliMinVoltage) );
+        }
+
+        // Check to see if calibration is complete and set to next mode if true
+        if ((g_yawCalibrationFlag == true) && (currentState == CALIBRATE_YAW)){
+            currentState = FLYING;
+        }
 
-           // Poll the buttons
-           updateButtons ();
+        // Switches task
+        // Runs every pass; edges are applied by the event task above, so a change
+        // of flight mode is picked up before the next control tick
+        updateSwitch();
+        const uint8_t switchState = checkSwitch();
+        switch (currentState) {
+            case FLYING:
+                if (switchState == SWITCH_DOWN) {
+                    stopSweep();
+                    currentState = LANDING;
+                    g_pidMain.integral = 0;
+                    g_pidTail.integral = 0;
+                }
+                break;
+            case LANDED:
+                if (switchState == SWITCH_UP) {
+                    currentState = FLYING;
+                    g_pidMain.integral = 0;
+                    g_pidTail.integral = 0;
+                }
+                break;
+            case WAITING_ON_SWITCH:
+                if (switchState == SWITCH_UP) {
+                    currentState = CALIBRATE_ALT;
+                    g_pidMain.integral = 0;
+                    g_pidTail.integral = 0;
+                }
+        }
+
+        // Button task
+        // Runs every pass like the switch task; edges seen during ADC calibration
+        // are debounced but not acted on
+        updateButtons ();
+        if (currentState != CALIBRATE_ADC){
+
+           // The RESET button flips between the values and strip chart pages in any state
+           if (checkButton (RESET) == PUSHED) {
+               toggleDisplayPage ();
+           }
 
-           if((checkButton (UP) == PUSHED) && (g_setPointAlt < 100)) {
+           // Set points can only be changed while flying
+           const bool flying = (currentState == FLYING);
+           if(buttonStep (UP) && flying && (g_setPointAlt < 100)) {
                g_setPointAlt += ALT_STEP;
-               g_errorIntMain = 0;
            }
-           if((checkButton (DOWN) == PUSHED) && (g_setPointAlt > 0)) {
+           if(buttonStep (DOWN) && flying && (g_setPointAlt > 0)) {
                g_setPointAlt -= ALT_STEP;
-               g_errorIntMain = 0;
            }
-           if((checkButton (LEFT) == PUSHED)) {
+           if(buttonStep (LEFT) && flying) {
                g_setPointYaw -= YAW_STEP;
                if (g_setPointYaw <= -180) {
                    g_setPointYaw += 360;
                }
            }
-           if((checkButton (RIGHT) == PUSHED)) {
+           if(buttonStep (RIGHT) && flying) {
                g_setPointYaw += YAW_STEP;
                if (g_setPointYaw > 180) {
                    g_setPointYaw -= 360;
@@ -298,85 +555,60 @@ main(void)
            }
        }
 
-        // Pwm task
-        if ((scheduledTasks[pwm].ready)){
-            scheduledTasks[pwm].ready = false;
-            switch (currentState) {
-                case CALIBRATE_ALT:
-                    setMainPWM (ui32MainFreq, g_controlAltitude);
-                    setTailPWM (ui32TailFreq, g_controlYaw);
-                    break;
-                case CALIBRATE_YAW:
-                    setMainPWM (ui32MainFreq, g_controlAltitude);
-                    setTailPWM (ui32TailFreq, YAW_CALIBRATION_TAIL_PWM);
-                    break;
-                case FLYING:
-                    setMainPWM (ui32MainFreq, g_controlAltitude);
-                    setTailPWM (ui32TailFreq, g_controlYaw);
-                    break;
-                case LANDING:
-                    setMainPWM (ui32MainFreq, g_controlAltitude);
-                    setTailPWM (ui32TailFreq, g_controlYaw);
-                    g_setPointYaw = 0; // Setpoint for Yaw
-                    if ((g_currentAngle > -ACCEPTABLE_LANDING_YAW_ERROR) && (g_currentAngle < ACCEPTABLE_LANDING_YAW_ERROR)) {
-                        g_setPointAlt -= 1;
-                        if (g_setPointAlt <= 0) {
-                            g_setPointAlt = 0;
-                        }
-                    } if ((g_currentAngle >= -ACCEPTABLE_LANDED_YAW_ERROR) && (g_currentAngle <= ACCEPTABLE_LANDED_YAW_ERROR) && (g_percentAltitude <= ACCEPTABLE_LANDED_ALT_ERROR)) {
-                        currentState = LANDED;
-                    }
-                    break;
-                case LANDED:
-                    setMainPWM (ui32MainFreq, 0);
-                    setTailPWM (ui32TailFreq, 0);
+        // Landing task
+        // Drops the altitude set point to the ground once the heli faces the
+        // reference; the altitude profile sets the rate of descent
+        if ((scheduledTasks[landing].ready)){
+            scheduledTasks[landing].ready = false;
+            if (currentState == LANDING) {
+                g_setPointYaw = 0; // Setpoint for Yaw
+                if ((g_currentAngle > -ACCEPTABLE_LANDING_YAW_ERROR) && (g_currentAngle < ACCEPTABLE_LANDING_YAW_ERROR)) {
                     g_setPointAlt = 0;
-                    break;
+                } if ((g_currentAngle >= -ACCEPTABLE_LANDED_YAW_ERROR) && (g_currentAngle <= ACCEPTABLE_LANDED_YAW_ERROR) && (g_percentAltitude <= ACCEPTABLE_LANDED_ALT_ERROR)) {
+                    currentState = LANDED;
+                }
             }
         }
 
-        // Adc task
-        // Code obtained from ADCDemo.c from Lab 3
-        // Background task: calculate the (approximate) mean of the values in the
-        // circular buffer and displays it, together with the sample number.
-        if ((scheduledTasks[adc].ready)){
-               scheduledTasks[adc].ready = false;
-               int32_t sum = 0;
-               for (i = 0; i < BUF_SIZE; i++){
-                   sum = sum + readCircBuf (&g_inBuffer);
-               }
-
-               mean = ((2 * sum + BUF_SIZE) / 2 / BUF_SIZE); // Mean calculation code from the lecture
-
-               if((currentState == CALIBRATE_ADC)){
-
-                   if (((mean != 0) && (g_ulSampCnt > (INIT_ADC_BUFFER_WAIT)))) {
-                       ADCHeliLandedVoltage = mean;
-                       ADCHeliMinVoltage = ADCHeliLandedVoltage - ONEVOLTAGEDROP;
-                       currentState = WAITING_ON_SWITCH;
-                   }
-               }
-
-               // Calculate the percentage altitude accounting for int division
-               g_percentAltitude = (MAX_PERCENT_ALT -  ((mean - ADCHeliMinVoltage) * MAX_PERCENT_ALT) / (ADCHeliLandedVoltage - ADCHeliMinVoltage) );
+        // Command task
+        // Characters are collected every pass so the receive FIFO never fills
+        if (UARTReadLine (g_command, sizeof (g_command))) {
+            runCommand (g_command);
+        }
 
+        // Frequency sweep task
+        if ((scheduledTasks[sweep].ready)){
+            scheduledTasks[sweep].ready = false;
+            updateSweep (g_percentAltitude);
         }
 
         // Uart task
-        if ((scheduledTasks[uart].ready && (currentState != CALIBRATE_ADC))){
+        // The display tasks below take their ready flag even while the ADC is
+        // calibrating, so a skipped run doesn't keep the loop from sleeping
+        if ((scheduledTasks[uart].ready)){
             scheduledTasks[uart].ready = false;
-            usprintf (g_statusStr,
-                    "\r\n"
-                    "|YAW: S=%2d A=%2d "
-                    "|ALT: S=%2d A=%2d "
-                    "|PWM: M=%2d T=%2d "
-                    "|Mode: %s \r\n"
-                    "\r\n",
-                    (int) g_setPointYaw, (int) g_currentAngle,
-                    (int)g_setPointAlt, (int) g_percentAltitude,
-                    (int) g_dispMainPWM, (int) g_dispTailPWM,
-                    currentStateCharArray[currentState]);
-            UARTSend (g_statusStr);
+            updateIdlePercent();
+            if (currentState != CALIBRATE_ADC) {
+                usprintf (g_statusStr,
+                        "\r\n"
+                        "|YAW: S=%2d A=%2d "
+                        "|ALT: S=%2d A=%2d "
+                        "|PWM: M=%2d T=%2d "
+                        "|Sat: M=%2d T=%2d "
+                        "|Mode: %s "
+                        "|Idle: %2d%% "
+                        "|Drop: %d \r\n"
+                        "\r\n",
+                        (int) g_setPointYaw, (int) g_currentAngle,
+                        (int)g_setPointAlt, (int) g_percentAltitude,
+                        (int) g_dispMainPWM, (int) g_dispTailPWM,
+                        (int) (getMainPWMSaturation() / PWM_PERMILLE_PER_PERCENT),
+                        (int) (getTailPWMSaturation() / PWM_PERMILLE_PER_PERCENT),
+                        currentStateCharArray[currentState],
+                        (int) g_idlePercent,
+                        (int) eventsDropped());
+                UARTSend (g_statusStr);
+            }
         }
 
         // Calibration task
@@ -388,9 +620,28 @@ main(void)
         }
 
         // Display task
-        if ((scheduledTasks[disp].ready) && (currentState != CALIBRATE_ADC)){
+        if ((scheduledTasks[disp].ready)){
             scheduledTasks[disp].ready = false;
-            screenDisplay(g_percentAltitude, g_currentAngle, g_dispMainPWM, g_dispTailPWM);
+            if (currentState != CALIBRATE_ADC) {
+                screenDisplay(g_percentAltitude, g_currentAngle, g_dispMainPWM, g_dispTailPWM);
+            }
         }
+
+        // Strip chart task
+        if ((scheduledTasks[chart].ready)){
+            scheduledTasks[chart].ready = false;
+            if (currentState != CALIBRATE_ADC) {
+                int16_t yawError = g_setPointYaw - (int16_t) g_currentAngle;
+                if (yawError > 180) {
+                    yawError -= 360;
+                } else if (yawError <= -180) {
+                    yawError += 360;
+                }
+                chartDisplay(g_percentAltitude, yawError);
+            }
+        }
+
+        // Nothing left to do until the next interrupt
+        idleSleep();
     }
 }
@@ -1,38 +1,73 @@
-/*
- * OrbitOLEDInterface.h
- *
- *  Created on: 23/11/2016
- *      Author: mdp46
- *	Modified on: 20/03/2017
- */
-
-#ifndef ORBITOLEDINTERFACE_H_
-#define ORBITOLEDINTERFACE_H_
-
-
-/*
- * OLEDStringDraw
- * 		return:		void
- * 		input:		*pcStr	zero terminated character string
- * 					ulColumn	Character column in x axis
- * 					ulRow		Character row in y axis
- *
- * 		purpose:	Prints string in character row and column specified
- *
- * 		Note: 8x8 pixel character rows and columns are used.
- * 			  Row and column 0,0 is at the top left of the display
- *
- */
-void OLEDStringDraw(const char *pcStr, uint32_t ulColumn, uint32_t ulRow);
-
-/*
- * OLEDInitialise
- *   	return: 	void
- *   	input: 		void
- *
- *   	purpose:	Runs the initialise routines for the OLED display
- */
-void OLEDInitialise (void);
-
-
-#endif /* ORBITOLEDINTERFACE_H_ */
+/*
+ * OrbitOLEDInterface.h
+ *
+ *  Created on: 23/11/2016
+ *      Author: mdp46
+ *	Modified on: 20/03/2017
+ */
+
+#ifndef ORBITOLEDINTERFACE_H_
+#define ORBITOLEDINTERFACE_H_
+
+
+/*
+ * OLEDStringDraw
+ * 		return:		void
+ * 		input:		*pcStr	zero terminated character string
+ * 					ulColumn	Character column in x axis
+ * 					ulRow		Character row in y axis
+ *
+ * 		purpose:	Prints string in character row and column specified
+ *
+ * 		Note: 8x8 pixel character rows and columns are used.
+ * 			  Row and column 0,0 is at the top left of the display
+ *
+ */
+void OLEDStringDraw(const char *pcStr, uint32_t ulColumn, uint32_t ulRow);
+
+/*
+ * OLEDCharDraw
+ * 		return:		void
+ * 		input:		cChar		character to draw
+ * 					ulColumn	Character column in x axis
+ * 					ulRow		Character row in y axis
+ *
+ * 		purpose:	Draws one character in the character row and column
+ * 					specified, without moving the text cursor. Only the
+ * 					columns of the cell that change are sent to the display.
+ */
+void OLEDCharDraw(char cChar, uint32_t ulColumn, uint32_t ulRow);
+
+/*
+ * OLEDBeginFrame
+ *   	return: 	void
+ *   	input: 		void
+ *
+ *   	purpose:	Starts a batch of drawing. Strings drawn with OLEDStringDraw
+ *   				are only rendered into the framebuffer until OLEDEndFrame
+ *   				is called, rather than each one updating the display.
+ */
+void OLEDBeginFrame (void);
+
+/*
+ * OLEDEndFrame
+ *   	return: 	void
+ *   	input: 		void
+ *
+ *   	purpose:	Ends a batch of drawing started with OLEDBeginFrame and
+ *   				sends the changed parts of the framebuffer to the display
+ *   				in a single update.
+ */
+void OLEDEndFrame (void);
+
+/*
+ * OLEDInitialise
+ *   	return: 	void
+ *   	input: 		void
+ *
+ *   	purpose:	Runs the initialise routines for the OLED display
+ */
+void OLEDInitialise (void);
+
+
+#endif /* ORBITOLEDINTERFACE_H_ */
@@ -1,57 +1,57 @@
-/************************************************************************/
-/*																		*/
-/*	FillPat.h	--	Fill Pattern Globals for patern ID's				*/
-/*																		*/
-/************************************************************************/
-/*	Author:		Gene Apperson											*/
-/*	Copyright 2013, Digilent Inc.										*/
-/************************************************************************/
-/*  File Description:													*/
-/*																		*/
-/*	This file defines a set of globals coresponding to the paterns used	*/
-/*	for filling objects in the FillPat.c array. Each patern coresponds	*/
-/*	to one of the values here.											*/
-/*																		*/
-/************************************************************************/
-/*  Revision History:													*/
-/*																		*/
-/*	07/20/2011(LukeR): created											*/
-/*	06/06/2013(JordanR):  Prepared for release							*/
-/*																		*/
-/************************************************************************/
-
-#if !defined(ORBITOLED_FILLPAT)
-#define	ORBITOLED_FILLPAT
-
-/* ------------------------------------------------------------ */
-/*					Miscellaneous Declarations					*/
-/* ------------------------------------------------------------ */
-#define	ciptnVals	8
-
-/* ------------------------------------------------------------ */
-/*					General Type Declarations					*/
-/* ------------------------------------------------------------ */
-#define	iptnBlank		0
-#define	iptnSolid		1
-#define	iptnCross		2
-#define	iptnSpekOpen	3
-#define	iptnSpekTight	4
-#define	iptnCirclesOpen	5
-#define	iptnCircleBar	6
-#define	iptnCarrots		7
-
-/* ------------------------------------------------------------ */
-/*					Object Class Declarations					*/
-/* ------------------------------------------------------------ */
-
-
-
-/* ------------------------------------------------------------ */
-/*					Variable Declarations						*/
-/* ------------------------------------------------------------ */
-
-/* ------------------------------------------------------------ */
-/*					Procedure Declarations						*/
-/* ------------------------------------------------------------ */
-
-#endif
+/************************************************************************/
+/*																		*/
+/*	FillPat.h	--	Fill Pattern Globals for patern ID's				*/
+/*																		*/
+/************************************************************************/
+/*	Author:		Gene Apperson											*/
+/*	Copyright 2013, Digilent Inc.										*/
+/************************************************************************/
+/*  File Description:													*/
+/*																		*/
+/*	This file defines a set of globals coresponding to the paterns used	*/
+/*	for filling objects in the FillPat.c array. Each patern coresponds	*/
+/*	to one of the values here.											*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/*																		*/
+/*	07/20/2011(LukeR): created											*/
+/*	06/06/2013(JordanR):  Prepared for release							*/
+/*																		*/
+/************************************************************************/
+
+#if !defined(ORBITOLED_FILLPAT)
+#define	ORBITOLED_FILLPAT
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+#define	ciptnVals	8
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+#define	iptnBlank		0
+#define	iptnSolid		1
+#define	iptnCross		2
+#define	iptnSpekOpen	3
+#define	iptnSpekTight	4
+#define	iptnCirclesOpen	5
+#define	iptnCircleBar	6
+#define	iptnCarrots		7
+
+/* ------------------------------------------------------------ */
+/*					Object Class Declarations					*/
+/* ------------------------------------------------------------ */
+
+
+
+/* ------------------------------------------------------------ */
+/*					Variable Declarations						*/
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+#endif
@@ -23,6 +23,8 @@
 /*				Include File Definitions						*/
 /* ------------------------------------------------------------ */
 
+#include <string.h>
+
 #include "delay.h"
 #include "LaunchPad.h"
 #include "OrbitBoosterPackDefs.h"
@@ -34,6 +36,14 @@
 /*				Local Type Definitions							*/
 /* ------------------------------------------------------------ */
 
+/* A transfer segment is a run of bytes sent to the display with the
+** Data/Cmd line held in one state.
+*/
+typedef struct {
+	int		fData;			//non-zero for display data, zero for commands
+	int		cb;				//number of bytes in the segment
+	char *	pb;				//first byte of the segment
+} OLEDSEG;
 
 /* ------------------------------------------------------------ */
 /*				Global Variables								*/
@@ -76,6 +86,70 @@ char *	pbOledFontUser;
 */
 char	rgbOledBmp[cbOledDispMax];
 
+/* This is the front buffer that updates are transmitted from. The
+** dirty parts of rgbOledBmp are copied here when an update starts,
+** while the transmitter is idle, so that drawing into rgbOledBmp can
+** carry on while the update is still being sent without tearing the
+** image on the display.
+*/
+char	rgbOledBmpTx[cbOledDispMax];
+
+/* Dirty region tracking. For each display memory page these hold the
+** first and last column that has been modified in rgbOledBmp since the
+** last update. A page is clean when the first column is greater than
+** the last column.
+*/
+int		rgcolOledDirtyFirst[cpagOledMax];
+int		rgcolOledDirtyLast[cpagOledMax];
+
+/* Background transfer state. OrbitOledUpdate builds a list of command
+** and data segments and the SSI3 interrupt handler walks through it,
+** streaming each segment to the SSI transmit FIFO with the uDMA. The
+** command bytes for each page are kept here as they must stay valid
+** until the uDMA has read them.
+*/
+OLEDSEG			rgsegOled[csegOledMax];
+char			rgbOledCmd[cpagOledMax][cbOledCmdMax];
+volatile int	csegOled;
+volatile int	isegOledCur;
+volatile int	fOledBusy;
+
+/* Power up sequence state. The display controller is brought up by
+** Timer 1 in the background and updates are held back until it is on.
+*/
+#define	stOledPwrVdd	0		//VDD on, waiting to reset the controller
+#define	stOledPwrReset	1		//reset held low
+#define	stOledPwrVbat	2		//VBAT on, waiting for the charge pump
+#define	stOledPwrFirst	3		//display on, whole buffer still to be sent
+#define	stOledPwrOn		4		//display on and ready for updates
+
+volatile int	stOledPwr;
+
+/* Display controller command sequences used by OrbitOledDevInit. Each
+** sequence is sent as a single chip select transaction.
+*/
+char	rgbOledCmdOff[] = {
+	0xAE						//display off
+};
+
+char	rgbOledCmdPower[] = {
+	0x8D, 0x14,					//enable the charge pump
+	0xD9, 0xF1					//pre-charge period
+};
+
+char	rgbOledCmdOn[] = {
+	0xA1,						//remap columns
+	0xC8,						//remap the rows
+	0xDA, 0x20,					//sequential COM, left/right remap enabled
+	0xAF						//display on
+};
+
+/* uDMA channel control table. The controller requires the table to be
+** aligned on a 1024 byte boundary.
+*/
+#pragma DATA_ALIGN(rgbOledDmaCtl, 1024)
+uint8_t			rgbOledDmaCtl[1024];
+
 /* ------------------------------------------------------------ */
 /*				Forward Declarations							*/
 /* ------------------------------------------------------------ */
@@ -83,8 +157,10 @@ char	rgbOledBmp[cbOledDispMax];
 void	OrbitOledHostInit();
 void	OrbitOledDevInit();
 void	OrbitOledDvrInit();
-char	Ssi3PutByte(char bVal);
-void	OrbitOledPutBuffer(int cb, char * rgbTx);
+void	OrbitOledPutCmds(int cb, char * rgbCmd);
+void	OrbitOledStartSeg();
+void	OrbitOledSsiIntHandler();
+void	OrbitOledDevInitStep();
 
 /* ------------------------------------------------------------ */
 /*				Procedure Definitions							*/
@@ -117,11 +193,13 @@ OrbitOledInit()
 	*/
 	OrbitOledDvrInit();
 
-	/* Init the OLED display hardware.
+	/* Start bringing up the OLED display hardware. This carries on in
+	** the background.
 	*/
 	OrbitOledDevInit();
 
-	/* Clear the display.
+	/* Clear the display. The cleared buffer is sent as soon as the
+	** display is on.
 	*/
 	OrbitOledClear();
 
@@ -161,6 +239,26 @@ OrbitOledHostInit()
 	SSIConfigSetExpClk(SSI3_BASE, SysCtlClockGet(), SSI_FRF_MOTO_MODE_0, SSI_MODE_MASTER, 8000000, 8);
 	SSIEnable(SSI3_BASE);
 
+	/* Set up the uDMA to feed the SSI3 transmit FIFO. Each transfer is
+	** one byte at a time from an incrementing buffer into the fixed data
+	** register, arbitrating every four bytes as the FIFO drains.
+	*/
+	SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+	uDMAEnable();
+	uDMAControlBaseSet(rgbOledDmaCtl);
+	uDMAChannelAssign(TXDMA_OLEDAssign);
+	uDMAChannelAttributeDisable(TXDMA_OLEDChannel, UDMA_ATTR_ALL);
+	uDMAChannelControlSet(TXDMA_OLEDChannel | UDMA_PRI_SELECT,
+						UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_4);
+	SSIDMAEnable(SSI3_BASE, SSI_DMA_TX);
+
+	/* The uDMA completion for a peripheral channel is signalled on the
+	** peripheral's own interrupt, which advances the transfer.
+	*/
+	fOledBusy = 0;
+	SSIIntRegister(SSI3_BASE, OrbitOledSsiIntHandler);
+	IntPrioritySet(INT_SSI3, INT_OLEDPriority);
+
 	/* Make power control pins be outputs with the supplies off
 	*/
 	GPIOPinWrite(VBAT_OLEDPort, VBAT_OLED, VBAT_OLED);
@@ -223,6 +321,13 @@ OrbitOledDvrInit()
 	xchOledMax = ccolOledMax / dxcoOledFontCur;
 	ychOledMax = crowOledMax / dycoOledFontCur;
 
+	/* Start with every page of the memory buffer clean.
+	*/
+	for (ib = 0; ib < cpagOledMax; ib++) {
+		rgcolOledDirtyFirst[ib] = ccolOledMax;
+		rgcolOledDirtyLast[ib] = -1;
+	}
+
 	/* Set the default character cursor position.
 	*/
 	OrbitOledSetCursor(0, 0);
@@ -253,7 +358,10 @@ OrbitOledDvrInit()
 **		none
 **
 **	Description:
-**		Initialize the OLED display controller and turn the display on.
+**		Start initializing the OLED display controller. The power up
+**		sequence needs over 100ms of delays, so it is run as a state
+**		machine stepped by Timer 1 and this returns straight away.
+**		OrbitOledIsReady reports when the display is on.
 */
 
 void
@@ -266,45 +374,101 @@ OrbitOledDevInit()
 
 	/* Start by turning VDD on and wait a while for the power to come up.
 	*/
+	stOledPwr = stOledPwrVdd;
 	GPIOPinWrite(VDD_OLEDPort, VDD_OLED, LOW);
-	DelayMs(1);
+	DelayMsAsync(1, OrbitOledDevInitStep);
 
-	/* Display off command
-	*/
-	Ssi3PutByte(0xAE);
+}
 
-	/* Bring Reset low and then high
-	*/
-	GPIOPinWrite(nRES_OLEDPort, nRES_OLED, LOW);
-	DelayMs(1);
-	GPIOPinWrite(nRES_OLEDPort, nRES_OLED, nRES_OLED);
+/* ------------------------------------------------------------ */
+/***	OrbitOledDevInitStep
+**
+**	Parameters:
+**		none
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Advance the display power up sequence. Called from the Timer 1
+**		interrupt each time the delay for the current step expires.
+*/
 
-	/* Send the Set Charge Pump and Set Pre-Charge Period commands
-	*/
-	Ssi3PutByte(0x8D);
-	Ssi3PutByte(0x14);
+void
+OrbitOledDevInitStep()
+	{
 
-	Ssi3PutByte(0xD9);
-	Ssi3PutByte(0xF1);
+	switch (stOledPwr) {
+		case	stOledPwrVdd:
+			/* Display off command
+			*/
+			OrbitOledPutCmds(sizeof(rgbOledCmdOff), rgbOledCmdOff);
+
+			/* Bring Reset low and then high
+			*/
+			GPIOPinWrite(nRES_OLEDPort, nRES_OLED, LOW);
+			stOledPwr = stOledPwrReset;
+			DelayMsAsync(1, OrbitOledDevInitStep);
+			break;
+
+		case	stOledPwrReset:
+			GPIOPinWrite(nRES_OLEDPort, nRES_OLED, nRES_OLED);
+
+			/* Send the Set Charge Pump and Set Pre-Charge Period commands
+			*/
+			OrbitOledPutCmds(sizeof(rgbOledCmdPower), rgbOledCmdPower);
+
+			/* Turn on VCC and wait 100ms
+			*/
+			GPIOPinWrite(VBAT_OLEDPort, VBAT_OLED, LOW);
+			stOledPwr = stOledPwrVbat;
+			DelayMsAsync(100, OrbitOledDevInitStep);
+			break;
+
+		case	stOledPwrVbat:
+			/* Send the commands to invert the display, select sequential COM
+			** configuration and turn the display on.
+			*/
+			OrbitOledPutCmds(sizeof(rgbOledCmdOn), rgbOledCmdOn);
+
+			/* The display memory holds whatever it powered up with, so
+			** the whole buffer has to go out on the next update. The
+			** dirty spans belong to the main loop, so OrbitOledUpdate
+			** marks them rather than this interrupt.
+			*/
+			stOledPwr = stOledPwrFirst;
+			break;
+
+		default:
+			break;
+	}
 
-	/* Turn on VCC and wait 100ms
-	*/
-	GPIOPinWrite(VBAT_OLEDPort, VBAT_OLED, LOW);
-	DelayMs(100);
+}
 
-	/* Send the commands to invert the display.
-	*/
-	Ssi3PutByte(0xA1);			//remap columns
-	Ssi3PutByte(0xC8);			//remap the rows
+/* ------------------------------------------------------------ */
+/***	OrbitOledIsReady
+**
+**	Parameters:
+**		none
+**
+**	Return Value:
+**		returns non-zero once the display has been powered up
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Report whether the background power up sequence has finished.
+*/
 
-	/* Send the commands to select sequential COM configuration
-	*/
-	Ssi3PutByte(0xDA);			//set COM configuration command
-	Ssi3PutByte(0x20);			//sequential COM, left/right remap enabled
+int
+OrbitOledIsReady()
+	{
 
-	/* Send Display On command
-	*/
-	Ssi3PutByte(0xAF);
+	return stOledPwr >= stOledPwrFirst;
 
 }
 
@@ -364,6 +528,10 @@ OrbitOledClearBuffer()
 		*pb++ = 0x00;
 	}
 
+	/* The whole display needs to be rewritten.
+	*/
+	OrbitOledInvalidateAll();
+
 }
 
 /* ------------------------------------------------------------ */
@@ -379,49 +547,132 @@ OrbitOledClearBuffer()
 **		none
 **
 **	Description:
-**		Update the OLED display with the contents of the memory buffer
+**		Update the OLED display with the contents of the memory buffer.
+**		Only the dirty column span of each page is sent to the display.
+**		The dirty spans are copied to the front buffer and transmitted
+**		from there in the background, so this returns at once and the
+**		caller may start drawing the next frame straight away. If a
+**		previous update is still in progress nothing is started and the
+**		dirty spans are left to be sent by a later call. The same
+**		applies while the display is still being powered up.
 */
 
 void
 OrbitOledUpdate()
 	{
 	int		ipag;
-//	int		icol;
-	char *	pb;
+	int		icolFirst;
+	int		icolLast;
+	int		cseg;
+	int		ib;
+	int		cb;
+	char *	pbCmd;
 
-	pb = rgbOledBmp;
+	if (fOledBusy || (stOledPwr < stOledPwrFirst)) {
+		return;
+	}
+
+	/* First update since power up, send the whole buffer.
+	*/
+	if (stOledPwr == stOledPwrFirst) {
+		OrbitOledInvalidateAll();
+		stOledPwr = stOledPwrOn;
+	}
+
+	cseg = 0;
 
 	for (ipag = 0; ipag < cpagOledMax; ipag++) {
 
-		GPIOPinWrite(nDC_OLEDPort, nDC_OLED, LOW);
+		icolFirst = rgcolOledDirtyFirst[ipag];
+		icolLast = rgcolOledDirtyLast[ipag];
 
-		/* Set the page address
+		/* Skip pages that haven't changed since the last update.
 		*/
-		Ssi3PutByte(0x22);		//Set page command
-		Ssi3PutByte(ipag);		//page number
+		if (icolFirst > icolLast) {
+			continue;
+		}
+
+		pbCmd = rgbOledCmd[ipag];
+
+		/* Set the page address. The page is given as both the start
+		** and end page so that the command is complete whether the
+		** controller treats it as a one or two argument command.
+		*/
+		pbCmd[0] = 0x22;						//Set page command
+		pbCmd[1] = ipag;						//page start
+		pbCmd[2] = ipag;						//page end
+
+		/* Start at the first dirty column
+		*/
+		pbCmd[3] = 0x00 | (icolFirst & 0x0F);	//set low nibble of column
+		pbCmd[4] = 0x10 | (icolFirst >> 4);		//set high nibble of column
+
+		rgsegOled[cseg].fData = 0;
+		rgsegOled[cseg].cb = 5;
+		rgsegOled[cseg].pb = pbCmd;
+		cseg += 1;
 
-		/* Start at the left column
+		/* Copy the dirty span of this memory page into the front buffer
+		** and follow the commands with it.
 		*/
-		Ssi3PutByte(0x00);		//set low nibble of column
-		Ssi3PutByte(0x10);		//set high nibble of column
+		ib = (ipag * ccolOledMax) + icolFirst;
+		cb = icolLast - icolFirst + 1;
+		memcpy(&rgbOledBmpTx[ib], &rgbOledBmp[ib], cb);
 
-		GPIOPinWrite(nDC_OLEDPort, nDC_OLED, nDC_OLED);
+		rgsegOled[cseg].fData = 1;
+		rgsegOled[cseg].cb = cb;
+		rgsegOled[cseg].pb = &rgbOledBmpTx[ib];
+		cseg += 1;
 
-		/* Copy this memory page of display data.
+		/* This page is now clean.
 		*/
-		OrbitOledPutBuffer(ccolOledMax, pb);
-		pb += ccolOledMax;
+		rgcolOledDirtyFirst[ipag] = ccolOledMax;
+		rgcolOledDirtyLast[ipag] = -1;
 
 	}
 
+	if (cseg == 0) {
+		return;
+	}
+
+	/* Start the first segment, the interrupt handler does the rest.
+	*/
+	csegOled = cseg;
+	isegOledCur = 0;
+	fOledBusy = 1;
+	OrbitOledStartSeg();
+
+}
+
+/* ------------------------------------------------------------ */
+/***	OrbitOledIsBusy
+**
+**	Parameters:
+**		none
+**
+**	Return Value:
+**		returns non-zero while an update is being sent to the display
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Report whether a background update is still in progress.
+*/
+
+int
+OrbitOledIsBusy()
+	{
+
+	return fOledBusy;
+
 }
 
 /* ------------------------------------------------------------ */
-/***	OrbitOledPutBuffer
+/***	OrbitOledStartSeg
 **
 **	Parameters:
-**		cb		- number of bytes to send/receive
-**		rgbTx	- pointer to the buffer to send
+**		none
 **
 **	Return Value:
 **		none
@@ -430,89 +681,198 @@ OrbitOledUpdate()
 **		none
 **
 **	Description:
-**		Send the bytes specified in rgbTx to the slave 
+**		Set the Data/Cmd line for the current transfer segment and hand
+**		the segment to the uDMA, selecting the display if this is the
+**		first segment. Must only be called while the SSI is idle.
 */
 
 void
-OrbitOledPutBuffer(int cb, char * rgbTx)
+OrbitOledStartSeg()
 	{
-	int32_t				ib;
-	uint32_t	    bTmp;
+	OLEDSEG *	pseg;
 
-	/* Bring the slave select line low
+	pseg = &rgsegOled[isegOledCur];
+
+	GPIOPinWrite(nDC_OLEDPort, nDC_OLED, (pseg->fData) ? nDC_OLED : LOW);
+
+	/* The whole update is one transaction, so the slave select line is
+	** only brought low for the first segment.
 	*/
-	GPIOPinWrite(nCS_OLEDPort, nCS_OLED, LOW);
+	if (isegOledCur == 0) {
+		GPIOPinWrite(nCS_OLEDPort, nCS_OLED, LOW);
+	}
+
+	uDMAChannelTransferSet(TXDMA_OLEDChannel | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+						pseg->pb, (void *)(SSI3_BASE + SSI_O_DR), pseg->cb);
+	uDMAChannelEnable(TXDMA_OLEDChannel);
+
+}
+
+/* ------------------------------------------------------------ */
+/***	OrbitOledSsiIntHandler
+**
+**	Parameters:
+**		none
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		SSI3 interrupt handler. Runs when the uDMA has finished
+**		loading a segment into the transmit FIFO, waits for the last
+**		bytes to shift out, then starts the next segment or ends the
+**		transaction and marks the update complete.
+*/
+
+void
+OrbitOledSsiIntHandler()
+	{
+	uint32_t	bTmp;
 
-	/* Write/Read the data
+	SSIIntClear(SSI3_BASE, SSIIntStatus(SSI3_BASE, true));
+
+	if (!fOledBusy || uDMAChannelIsEnabled(TXDMA_OLEDChannel)) {
+		return;
+	}
+
+	/* The uDMA is done once the last byte is in the FIFO, which is at
+	** most 8 bytes (8us at 8MHz) from being on the wire. The Data/Cmd
+	** and slave select lines must not change until it is.
 	*/
-	for (ib = 0; ib < cb; ib++) {
-		/* Wait for transmitter to be ready
-		*/
-		while (SSIBusy(SSI3_BASE));
+	while (SSIBusy(SSI3_BASE));
 
-		/* Write the next transmit byte.
-		*/
-		SSIDataPut(SSI3_BASE, (uint32_t)*rgbTx++);
+	/* Throw away the bytes clocked in while transmitting.
+	*/
+	while (SSIDataGetNonBlocking(SSI3_BASE, &bTmp));
 
-		/* Wait for receive byte.
+	isegOledCur += 1;
+	if (isegOledCur < csegOled) {
+		OrbitOledStartSeg();
+	}
+	else {
+		/* Bring the slave select line high
 		*/
-		while (SSIBusy(SSI3_BASE));
-		SSIDataGet(SSI3_BASE, &bTmp);
+		GPIOPinWrite(nCS_OLEDPort, nCS_OLED, nCS_OLED);
+		fOledBusy = 0;
+	}
+
+}
 
+/* ------------------------------------------------------------ */
+/***	OrbitOledInvalidate
+**
+**	Parameters:
+**		ipag		- display memory page containing the span
+**		icolFirst	- first modified column
+**		icolLast	- last modified column
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Mark a span of columns in one page of the memory buffer as
+**		modified so that it is sent on the next OrbitOledUpdate.
+*/
+
+void
+OrbitOledInvalidate(int ipag, int icolFirst, int icolLast)
+	{
+
+	if ((ipag < 0) || (ipag >= cpagOledMax)) {
+		return;
+	}
+
+	if (icolFirst < rgcolOledDirtyFirst[ipag]) {
+		rgcolOledDirtyFirst[ipag] = icolFirst;
+	}
+
+	if (icolLast > rgcolOledDirtyLast[ipag]) {
+		rgcolOledDirtyLast[ipag] = icolLast;
 	}
 
-	/* Bring the slave select line high
-	*/
-	GPIOPinWrite(nCS_OLEDPort, nCS_OLED, nCS_OLED);
-	
 }
 
 /* ------------------------------------------------------------ */
-/***	Ssi3PutByte
+/***	OrbitOledInvalidateAll
 **
 **	Parameters:
-**		bVal		- byte value to write
+**		none
 **
 **	Return Value:
-**		Returns byte read
+**		none
 **
 **	Errors:
 **		none
 **
 **	Description:
-**		Write/Read a byte on SSI port 3
+**		Mark the entire memory buffer as modified.
 */
 
-char
-Ssi3PutByte(char bVal)
+void
+OrbitOledInvalidateAll()
 	{
-	uint32_t	        bRx;
+	int		ipag;
+
+	for (ipag = 0; ipag < cpagOledMax; ipag++) {
+		rgcolOledDirtyFirst[ipag] = 0;
+		rgcolOledDirtyLast[ipag] = ccolOledMax - 1;
+	}
+
+}
+
+/* ------------------------------------------------------------ */
+/***	OrbitOledPutCmds
+**
+**	Parameters:
+**		cb		- number of command bytes to send
+**		rgbCmd	- pointer to the command bytes
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Send a sequence of command bytes to the display controller in
+**		a single chip select transaction. The bytes are pushed straight
+**		into the transmit FIFO, only waiting when it is full, and the
+**		received bytes are discarded once the sequence has gone out.
+**		Only used by the power up sequence, before any background
+**		update can be running.
+*/
+
+void
+OrbitOledPutCmds(int cb, char * rgbCmd)
+	{
+	int			ib;
+	uint32_t	bTmp;
+
+	GPIOPinWrite(nDC_OLEDPort, nDC_OLED, LOW);
 
 	/* Bring the slave select line low
 	*/
 	GPIOPinWrite(nCS_OLEDPort, nCS_OLED, LOW);
 
-	/* Wait for transmitter to be ready
-	*/
-	while (SSIBusy(SSI3_BASE));
-
-	/* Write the next transmit byte.
-	*/
-	SSIDataPut(SSI3_BASE, (uint32_t)bVal);
+	for (ib = 0; ib < cb; ib++) {
+		SSIDataPut(SSI3_BASE, (uint32_t)*rgbCmd++);
+	}
 
-	/* Wait for receive byte.
+	/* Wait for the last byte to leave the shifter, then empty the
+	** receive FIFO.
 	*/
 	while (SSIBusy(SSI3_BASE));
-
-	/* Put the received byte in the buffer.
-	*/
-	SSIDataGet(SSI3_BASE, &bRx);
+	while (SSIDataGetNonBlocking(SSI3_BASE, &bTmp));
 
 	/* Bring the slave select line high
 	*/
 	GPIOPinWrite(nCS_OLEDPort, nCS_OLED, nCS_OLED);
-	
-	return (char)bRx;
 
 }
 
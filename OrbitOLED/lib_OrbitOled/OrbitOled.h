@@ -1,74 +1,81 @@
-/************************************************************************/
-/*																		*/
-/*	OrbitOled.h	--	Interface Declarations for OLED Display Driver 		*/
-/*																		*/
-/************************************************************************/
-/*	Author:		Gene Apperson											*/
-/*	Copyright 2013, Digilent Inc.										*/
-/************************************************************************/
-/*  File Description:													*/
-/*																		*/
-/*																		*/
-/************************************************************************/
-/*  Revision History:													*/
-/*																		*/
-/*	04/29/2011(GeneA): created for PmodOLED								*/
-/*	04/04/2013(JordanR):  Ported for Stellaris LaunchPad + Orbit BP		*/
-/*	06/06/2013(JordanR):  Prepared for release							*/
-/*																		*/
-/************************************************************************/
-
-#if !defined(ORBITOLED_INC)
-#define	ORBITOLED_INC
-
-/* ------------------------------------------------------------ */
-/*					Miscellaneous Declarations					*/
-/* ------------------------------------------------------------ */
-
-#define	cbOledDispMax	512		//max number of bytes in display buffer
-
-#define	ccolOledMax		128		//number of display columns
-#define	crowOledMax		32		//number of display rows
-#define	cpagOledMax		4		//number of display memory pages
-
-#define	cbOledChar		8		//font glyph definitions is 8 bytes long
-#define	chOledUserMax	0x20	//number of character defs in user font table
-#define	cbOledFontUser	(chOledUserMax*cbOledChar)
-
-/* Graphics drawing modes.
-*/
-#define	modOledSet		0
-#define	modOledOr		1
-#define	modOledAnd		2
-#define	modOledXor		3
-
-/* ------------------------------------------------------------ */
-/*					General Type Declarations					*/
-/* ------------------------------------------------------------ */
-
-/* ------------------------------------------------------------ */
-/*					Object Class Declarations					*/
-/* ------------------------------------------------------------ */
-
-
-
-/* ------------------------------------------------------------ */
-/*					Variable Declarations						*/
-/* ------------------------------------------------------------ */
-
-
-
-/* ------------------------------------------------------------ */
-/*					Procedure Declarations						*/
-/* ------------------------------------------------------------ */
-
-void	OrbitOledInit();
-void	OrbitOledClear();
-void	OrbitOledClearBuffer();
-void	OrbitOledUpdate();
-
-/* ------------------------------------------------------------ */
-
-#endif
-
-/************************************************************************/
+/************************************************************************/
+/*																		*/
+/*	OrbitOled.h	--	Interface Declarations for OLED Display Driver 		*/
+/*																		*/
+/************************************************************************/
+/*	Author:		Gene Apperson											*/
+/*	Copyright 2013, Digilent Inc.										*/
+/************************************************************************/
+/*  File Description:													*/
+/*																		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/*																		*/
+/*	04/29/2011(GeneA): created for PmodOLED								*/
+/*	04/04/2013(JordanR):  Ported for Stellaris LaunchPad + Orbit BP		*/
+/*	06/06/2013(JordanR):  Prepared for release							*/
+/*																		*/
+/************************************************************************/
+
+#if !defined(ORBITOLED_INC)
+#define	ORBITOLED_INC
+
+/* ------------------------------------------------------------ */
+/*					Miscellaneous Declarations					*/
+/* ------------------------------------------------------------ */
+
+#define	cbOledDispMax	512		//max number of bytes in display buffer
+
+#define	ccolOledMax		128		//number of display columns
+#define	crowOledMax		32		//number of display rows
+#define	cpagOledMax		4		//number of display memory pages
+
+#define	cbOledCmdMax	8		//max command bytes sent ahead of a page of data
+#define	csegOledMax		(2*cpagOledMax)	//max transfer segments in one update
+
+#define	cbOledChar		8		//font glyph definitions is 8 bytes long
+#define	chOledUserMax	0x20	//number of character defs in user font table
+#define	cbOledFontUser	(chOledUserMax*cbOledChar)
+
+/* Graphics drawing modes.
+*/
+#define	modOledSet		0
+#define	modOledOr		1
+#define	modOledAnd		2
+#define	modOledXor		3
+
+/* ------------------------------------------------------------ */
+/*					General Type Declarations					*/
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/*					Object Class Declarations					*/
+/* ------------------------------------------------------------ */
+
+
+
+/* ------------------------------------------------------------ */
+/*					Variable Declarations						*/
+/* ------------------------------------------------------------ */
+
+
+
+/* ------------------------------------------------------------ */
+/*					Procedure Declarations						*/
+/* ------------------------------------------------------------ */
+
+void	OrbitOledInit();
+void	OrbitOledClear();
+void	OrbitOledClearBuffer();
+void	OrbitOledUpdate();
+void	OrbitOledInvalidate(int ipag, int icolFirst, int icolLast);
+void	OrbitOledInvalidateAll();
+int		OrbitOledIsBusy();
+int		OrbitOledIsReady();
+
+/* ------------------------------------------------------------ */
+
+#endif
+
+/************************************************************************/
@@ -23,6 +23,9 @@
 /*				Include File Definitions						*/
 /* ------------------------------------------------------------ */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "FillPat.h"
 #include "LaunchPad.h"
 #include "OrbitBoosterPackDefs.h"
@@ -57,6 +60,48 @@ extern int		dycoOledFontCur;
 char	(*pfnDoRop)(char bPix, char bDsp, char mskPix);
 int		modOledCur;
 
+/* Raster operations expanded inline by the fast drawing paths, so that
+** the drawing mode is chosen once per run of bytes rather than through
+** an indirect call through pfnDoRop for every byte. These must match
+** the OrbitOledRopXxx functions below.
+*/
+#define	RopSet(bPix, bDsp, mskPix)	(char)(((bDsp) & ~(mskPix)) | ((bPix) & (mskPix)))
+#define	RopOr(bPix, bDsp, mskPix)	(char)((bDsp) | ((bPix) & (mskPix)))
+#define	RopAnd(bPix, bDsp, mskPix)	(char)((bDsp) & ((bPix) & (mskPix)))
+#define	RopXor(bPix, bDsp, mskPix)	(char)((bDsp) ^ ((bPix) & (mskPix)))
+
+/* Apply raster operation Rop across cb display bytes starting at pb,
+** with the source byte given by expression bSrc (which may use ib),
+** keeping track of the first and last byte actually changed.
+*/
+#define	RopRunLoop(Rop, bSrc)								\
+	for (ib = 0; ib < cb; ib++) {							\
+		bNew = Rop((bSrc), pb[ib], mskPix);					\
+		if (bNew != pb[ib]) {								\
+			pb[ib] = bNew;									\
+			if (ibLast < 0) {								\
+				ibFirst = ib;								\
+			}												\
+			ibLast = ib;									\
+		}													\
+	}
+
+#define	RopRunModes(bSrc)									\
+	switch (modOledCur) {									\
+		case	modOledOr:									\
+			RopRunLoop(RopOr, bSrc);						\
+			break;											\
+		case	modOledAnd:									\
+			RopRunLoop(RopAnd, bSrc);						\
+			break;											\
+		case	modOledXor:									\
+			RopRunLoop(RopXor, bSrc);						\
+			break;											\
+		default:											\
+			RopRunLoop(RopSet, bSrc);						\
+			break;											\
+	}
+
 /* ------------------------------------------------------------ */
 /*				Forward Declarations							*/
 /* ------------------------------------------------------------ */
@@ -71,6 +116,9 @@ char	OrbitOledRopAnd(char bPix, char bDsp, char mskPix);
 char	OrbitOledRopXor(char bPix, char bDsp, char mskPix);
 int		OrbitOledClampXco(int xco);
 int		OrbitOledClampYco(int yco);
+void	OrbitOledRopFill(char * pb, int cb, char bPix, char mskPix);
+void	OrbitOledRopCopy(char * pb, char * pbSrc, int cb, char mskPix);
+void	OrbitOledDirtyRun(char * pb, int ibFirst, int ibLast);
 
 /* ------------------------------------------------------------ */
 /*				Procedure Definitions							*/
@@ -303,8 +351,36 @@ OrbitOledGetDrawMode()
 void
 OrbitOledDrawPixel()
 	{
+	char	bNew;
+	char	bPix;
+	char	mskPix;
+	int		ib;
+
+	bPix = clrOledCur << bnOledCur;
+	mskPix = 1 << bnOledCur;
+
+	switch (modOledCur) {
+		case	modOledOr:
+			bNew = RopOr(bPix, *pbOledCur, mskPix);
+			break;
+		case	modOledAnd:
+			bNew = RopAnd(bPix, *pbOledCur, mskPix);
+			break;
+		case	modOledXor:
+			bNew = RopXor(bPix, *pbOledCur, mskPix);
+			break;
+		default:
+			bNew = RopSet(bPix, *pbOledCur, mskPix);
+			break;
+	}
 
-	*pbOledCur = (*pfnDoRop)((clrOledCur << bnOledCur), *pbOledCur, (1<<bnOledCur));
+	/* Only mark the display dirty if the pixel actually changed.
+	*/
+	if (bNew != *pbOledCur) {
+		*pbOledCur = bNew;
+		ib = pbOledCur - rgbOledBmp;
+		OrbitOledInvalidate(ib / ccolOledMax, ib & (ccolOledMax-1), ib & (ccolOledMax-1));
+	}
 
 }
 
@@ -361,16 +437,59 @@ OrbitOledLineTo(int xco, int yco)
 	int		dyco;
 	void	(*pfnMajor)();
 	void	(*pfnMinor)();
+	int		xcoFirst;
+	int		ycoFirst;
+	int		ycoLast;
+	int		ipag;
+	int		mskPag;
 
 	/* Clamp the point to be on the display.
 	*/
 	xco = OrbitOledClampXco(xco);
 	yco = OrbitOledClampYco(yco);
 
-	/* Determine which octant the line occupies
-	*/
 	dxco = xco - xcoOledCur;
 	dyco = yco - ycoOledCur;
+
+	/* Horizontal and vertical lines are drawn a run of bytes at a time.
+	** As with the general case, the end point itself isn't drawn.
+	*/
+	if ((dyco == 0) && (dxco != 0)) {
+		/* A horizontal line sets the same bit in consecutive bytes
+		** of one page.
+		*/
+		xcoFirst = (dxco > 0) ? xcoOledCur : xco + 1;
+		OrbitOledRopFill(&rgbOledBmp[((yco/8) * ccolOledMax) + xcoFirst], abs(dxco),
+							(clrOledCur != 0) ? 0xFF : 0x00, 1 << (yco & 0x07));
+		OrbitOledMoveTo(xco, yco);
+		return;
+	}
+
+	if ((dxco == 0) && (dyco != 0) && (modOledCur != modOledAnd)) {
+		/* A vertical line sets a contiguous group of bits in one byte
+		** of each page it crosses. In AND mode each pixel drawn clears
+		** the others in its byte, so that case is left to the general
+		** loop below.
+		*/
+		ycoFirst = (dyco > 0) ? ycoOledCur : yco + 1;
+		ycoLast = ycoFirst + abs(dyco) - 1;
+		for (ipag = ycoFirst/8; ipag <= ycoLast/8; ipag++) {
+			mskPag = 0xFF;
+			if (ipag == ycoFirst/8) {
+				mskPag &= ~((1 << (ycoFirst & 0x07)) - 1);
+			}
+			if (ipag == ycoLast/8) {
+				mskPag &= (1 << ((ycoLast & 0x07) + 1)) - 1;
+			}
+			OrbitOledRopFill(&rgbOledBmp[(ipag * ccolOledMax) + xco], 1,
+								(clrOledCur != 0) ? 0xFF : 0x00, mskPag);
+		}
+		OrbitOledMoveTo(xco, yco);
+		return;
+	}
+
+	/* Determine which octant the line occupies
+	*/
 	if (abs(dxco) >= abs(dyco)) {
 		/* Line is x-major
 		*/
@@ -501,16 +620,26 @@ OrbitOledFillRect(int xco, int yco)
 	int		ycoTop;
 	int		ycoBottom;
 	int		ibPat;
-	char *	pbCur;
 	char *	pbLeft;
-	int		xcoCur;
 	char	mskPat;
+	int		fPatSolid;
+	char	rgbPat[ccolOledMax];
 
 	/* Clamp the point to be on the display.
 	*/
 	xco = OrbitOledClampXco(xco);
 	yco = OrbitOledClampYco(yco);
 
+	/* A pattern with every byte the same (such as the solid black and
+	** white standard patterns) doesn't need to be looked up per column.
+	*/
+	fPatSolid = 1;
+	for (ibPat = 1; ibPat < 8; ibPat++) {
+		if (pbOledPatCur[ibPat] != pbOledPatCur[0]) {
+			fPatSolid = 0;
+		}
+	}
+
 	/* Set up the four sides of the rectangle.
 	*/
 	if (xcoOledCur < xco) {
@@ -532,6 +661,15 @@ OrbitOledFillRect(int xco, int yco)
 	}
 
 
+	/* Otherwise lay the pattern out once across the width of the
+	** rectangle, so that each stripe is a copy from the same row.
+	*/
+	if (!fPatSolid) {
+		for (ibPat = 0; ibPat <= xcoRight - xcoLeft; ibPat++) {
+			rgbPat[ibPat] = pbOledPatCur[(xcoLeft + ibPat) & 0x07];
+		}
+	}
+
 	while (ycoTop <= ycoBottom) {
 		/* Compute the address of the left edge of the rectangle for this
 		** stripe across the rectangle.
@@ -550,22 +688,13 @@ OrbitOledFillRect(int xco, int yco)
 		*/
 		if ((ycoTop / 8) == (ycoBottom / 8)) {
 			mskPat |= ~((1 << ((ycoBottom&0x07)+1)) - 1);
-		}											
-		ibPat = xcoLeft & 0x07;		//index to first pattern byte
-		xcoCur = xcoLeft;
-		pbCur = pbLeft;
+		}
 
-		/* Loop through all of the bytes horizontally making up this stripe
-		** of the rectangle.
-		*/
-		while (xcoCur <= xcoRight) {
-			*pbCur = (*pfnDoRop)(*(pbOledPatCur+ibPat), *pbCur, ~mskPat);
-			xcoCur += 1;
-			pbCur += 1;
-			ibPat += 1;
-			if (ibPat > 7) {
-				ibPat = 0;
-			}
+		if (fPatSolid) {
+			OrbitOledRopFill(pbLeft, xcoRight - xcoLeft + 1, pbOledPatCur[0], ~mskPat);
+		}
+		else {
+			OrbitOledRopCopy(pbLeft, rgbPat, xcoRight - xcoLeft + 1, ~mskPat);
 		}
 
 		/* Advance to the next horizontal stripe.
@@ -709,13 +838,13 @@ OrbitOledPutBmp(int dxco, int dyco, char * pbBits)
 	char *	pbDspLeft;
 	char *	pbBmpCur;
 	char *	pbBmpLeft;
-	int		xcoCur;
-	char	bBmp;
+	int		ib;
 	char	mskEnd;
 	char	mskUpper;
 	char	mskLower;
 	int		bnAlign;
 	int		fTop;
+	char	rgbRow[ccolOledMax];
 
 	/* Set up the four sides of the destination rectangle.
 	*/
@@ -753,34 +882,29 @@ OrbitOledPutBmp(int dxco, int dyco, char * pbBits)
 		if (fTop) {
 			mskEnd &= ~mskUpper;
 		}
-											
-		xcoCur = xcoLeft;
+
 		pbDspCur = pbDspLeft;
 		pbBmpCur = pbBmpLeft;
 
-		/* Loop through all of the bytes horizontally making up this stripe
-		** of the rectangle.
-		*/
 		if (bnAlign == 0) {
-			while (xcoCur < xcoRight) {
-				*pbDspCur = (*pfnDoRop)(*pbBmpCur, *pbDspCur, mskEnd);
-				xcoCur += 1;
-				pbDspCur += 1;
-				pbBmpCur += 1;
-			}
+			/* The bitmap rows line up with the display pages, so each
+			** stripe is a straight byte copy.
+			*/
+			OrbitOledRopCopy(pbDspCur, pbBmpCur, xcoRight - xcoLeft, mskEnd);
 		}
 		else {
-			while (xcoCur < xcoRight) {
-				bBmp = ((*pbBmpCur) << bnAlign);
+			/* Otherwise each display byte takes the bottom of one bitmap
+			** row and the top of the row above it. Build the stripe from
+			** the two rows and copy that.
+			*/
+			for (ib = 0; ib < xcoRight - xcoLeft; ib++) {
+				rgbRow[ib] = (pbBmpCur[ib] << bnAlign);
 				if (!fTop) {
-					bBmp |= ((*(pbBmpCur - dxco) >> (8-bnAlign)) & ~mskLower);
+					rgbRow[ib] |= ((*(pbBmpCur + ib - dxco) >> (8-bnAlign)) & ~mskLower);
 				}
-				bBmp &= mskEnd;
-				*pbDspCur = (*pfnDoRop)(bBmp, *pbDspCur, mskEnd);
-				xcoCur += 1;
-				pbDspCur += 1;
-				pbBmpCur += 1;
+				rgbRow[ib] &= mskEnd;
 			}
+			OrbitOledRopCopy(pbDspCur, rgbRow, xcoRight - xcoLeft, mskEnd);
 		}
 
 		/* Advance to the next horizontal stripe.
@@ -863,8 +987,207 @@ OrbitOledDrawString(char * sz)
 	}
 }
 
+/* ------------------------------------------------------------ */
+/***	OrbitOledScrollLeft
+**
+**	Parameters:
+**		ipagFirst	- first display memory page to scroll
+**		ipagLast	- last display memory page to scroll
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Move the contents of the specified pages of the display
+**		buffer one column to the left. The leftmost column is lost
+**		and the rightmost column is cleared. Only the columns whose
+**		contents actually change are marked as needing to be sent, so
+**		blank areas of a scrolling plot cost no display traffic.
+*/
+
+void
+OrbitOledScrollLeft(int ipagFirst, int ipagLast)
+	{
+	char *	pb;
+	char	bNew;
+	int		ipag;
+	int		ib;
+	int		ibFirst;
+	int		ibLast;
+
+	if (ipagFirst < 0) {
+		ipagFirst = 0;
+	}
+	if (ipagLast >= cpagOledMax) {
+		ipagLast = cpagOledMax-1;
+	}
+
+	for (ipag = ipagFirst; ipag <= ipagLast; ipag++) {
+		pb = &rgbOledBmp[ipag*ccolOledMax];
+		ibFirst = ccolOledMax;
+		ibLast = -1;
+
+		/* Each column takes the one to its right; the last takes
+		** a blank column.
+		*/
+		for (ib = 0; ib < ccolOledMax; ib++) {
+			bNew = (ib < ccolOledMax-1) ? pb[ib+1] : 0;
+			if (bNew != pb[ib]) {
+				pb[ib] = bNew;
+				if (ibFirst > ibLast) {
+					ibFirst = ib;
+				}
+				ibLast = ib;
+			}
+		}
+
+		OrbitOledDirtyRun(pb, ibFirst, ibLast);
+	}
+
+}
+
 /* ------------------------------------------------------------ */
 /*				Internal Support Routines						*/
+/* ------------------------------------------------------------ */
+/***	OrbitOledRopFill
+**
+**	Parameters:
+**		pb			- first display byte of the run
+**		cb			- number of bytes in the run
+**		bPix		- pixel bits to apply to every byte
+**		mskPix		- bits within each byte to affect
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Apply the current drawing mode with the same pixel byte to a
+**		run of consecutive display bytes in one page, and mark the
+**		bytes that changed as dirty. Whole byte set mode fills are
+**		done with memset.
+*/
+
+void
+OrbitOledRopFill(char * pb, int cb, char bPix, char mskPix)
+	{
+	int		ib;
+	int		ibFirst;
+	int		ibLast;
+	char	bNew;
+
+	ibFirst = cb;
+	ibLast = -1;
+
+	if ((modOledCur == modOledSet) && ((char)~mskPix == 0)) {
+		/* Only rewrite the part of the run that differs.
+		*/
+		for (ibFirst = 0; (ibFirst < cb) && (pb[ibFirst] == bPix); ibFirst++);
+		if (ibFirst == cb) {
+			return;
+		}
+		for (ibLast = cb - 1; pb[ibLast] == bPix; ibLast--);
+		memset(pb + ibFirst, bPix, ibLast - ibFirst + 1);
+	}
+	else {
+		RopRunModes(bPix);
+	}
+
+	OrbitOledDirtyRun(pb, ibFirst, ibLast);
+
+}
+
+/* ------------------------------------------------------------ */
+/***	OrbitOledRopCopy
+**
+**	Parameters:
+**		pb			- first display byte of the run
+**		pbSrc		- source bytes, one per display byte
+**		cb			- number of bytes in the run
+**		mskPix		- bits within each byte to affect
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Apply the current drawing mode from a row of source bytes to
+**		a run of consecutive display bytes in one page, and mark the
+**		bytes that changed as dirty. Whole byte set mode copies are
+**		done with memcpy.
+*/
+
+void
+OrbitOledRopCopy(char * pb, char * pbSrc, int cb, char mskPix)
+	{
+	int		ib;
+	int		ibFirst;
+	int		ibLast;
+	char	bNew;
+
+	ibFirst = cb;
+	ibLast = -1;
+
+	if ((modOledCur == modOledSet) && ((char)~mskPix == 0)) {
+		/* Only rewrite the part of the run that differs.
+		*/
+		for (ibFirst = 0; (ibFirst < cb) && (pb[ibFirst] == pbSrc[ibFirst]); ibFirst++);
+		if (ibFirst == cb) {
+			return;
+		}
+		for (ibLast = cb - 1; pb[ibLast] == pbSrc[ibLast]; ibLast--);
+		memcpy(pb + ibFirst, pbSrc + ibFirst, ibLast - ibFirst + 1);
+	}
+	else {
+		RopRunModes(pbSrc[ib]);
+	}
+
+	OrbitOledDirtyRun(pb, ibFirst, ibLast);
+
+}
+
+/* ------------------------------------------------------------ */
+/***	OrbitOledDirtyRun
+**
+**	Parameters:
+**		pb			- first display byte of a run
+**		ibFirst		- offset of the first changed byte in the run
+**		ibLast		- offset of the last changed byte in the run
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Mark the changed part of a run of display bytes in one page
+**		as dirty. Nothing is marked if ibFirst is past ibLast.
+*/
+
+void
+OrbitOledDirtyRun(char * pb, int ibFirst, int ibLast)
+	{
+	int		ibDsp;
+
+	if (ibFirst > ibLast) {
+		return;
+	}
+
+	ibDsp = pb - rgbOledBmp;
+	OrbitOledInvalidate(ibDsp / ccolOledMax,
+						(ibDsp & (ccolOledMax-1)) + ibFirst,
+						(ibDsp & (ccolOledMax-1)) + ibLast);
+
+}
+
 /* ------------------------------------------------------------ */
 /***	OrbitOledRopSet
 **
@@ -1,130 +1,217 @@
-/************************************************************************/
-/*																		*/
-/*	delay.c	--	Time Delay Functions									*/
-/*																		*/
-/************************************************************************/
-/*	Author: 	Gene Apperson											*/
-/*	Copyright 2013, Digilent Inc.										*/
-/************************************************************************/
-/*  Module Description: 												*/
-/*																		*/
-/*																		*/
-/************************************************************************/
-/*  Revision History:													*/
-/*																		*/
-/*	04/29/2011(GeneA): created for PmodOLED								*/
-/*	04/04/2013(JordanR):  Ported for Stellaris LaunchPad + Orbit BP		*/
-/*	06/06/2013(JordanR):  Prepared for release							*/
-/*																		*/
-/************************************************************************/
-
-
-/* ------------------------------------------------------------ */
-/*				Include File Definitions						*/
-/* ------------------------------------------------------------ */
-
-#include "delay.h"
-#include "LaunchPad.h"
-#include "OrbitBoosterPackDefs.h"
-
-/* ------------------------------------------------------------ */
-/*				Local Type Definitions							*/
-/* ------------------------------------------------------------ */
-
-
-/* ------------------------------------------------------------ */
-/*				Global Variables								*/
-/* ------------------------------------------------------------ */
-
-
-/* ------------------------------------------------------------ */
-/*				Local Variables									*/
-/* ------------------------------------------------------------ */
-
-
-/* ------------------------------------------------------------ */
-/*				Forward Declarations							*/
-/* ------------------------------------------------------------ */
-
-
-/* ------------------------------------------------------------ */
-/*				Procedure Definitions							*/
-/* ------------------------------------------------------------ */
-/***	DelayInit
-**
-**	Parameters:
-**		none
-**
-**	Return Value:
-**		none
-**
-**	Errors:
-**		none
-**
-**	Description:
-**		Initialized the hardware for use by delay functions. This
-**		initializes Timer 1 to count
-*/
-
-void
-DelayInit()	
-	{
-
-	/* Configure Timer 1. 
-	*/
-	SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
-
-	TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC_UP);
-	TimerEnable(TIMER1_BASE, TIMER_A);
-
-
-}
-
-/* ------------------------------------------------------------ */
-/***	DelayMs
-**
-**	Parameters:
-**		cms			- number of milliseconds to delay
-**
-**	Return Value:
-**		none
-**
-**	Errors:
-**		none
-**
-**	Description:
-**		Delay the requested number of milliseconds. Uses Timer1.
-*/
-
-void
-DelayMs(int cms)
-	{
-	int		ims;
-
-	for (ims=0; ims<cms; ims++) {
-		/*
-		 * Clear Timer1
-		 */
-		HWREG(TIMER1_BASE + TIMER_O_TAV) = 0;
-		while (TimerValueGet(TIMER1_BASE, TIMER_A) < cntMsDelay);
-	}
-
-}		
-
-/* ------------------------------------------------------------ */
-/***	ProcName
-**
-**	Parameters:
-**
-**	Return Value:
-**
-**	Errors:
-**
-**	Description:
-**
-*/
-
-/* ------------------------------------------------------------ */
-
-/************************************************************************/
-
+/************************************************************************/
+/*																		*/
+/*	delay.c	--	Time Delay Functions									*/
+/*																		*/
+/************************************************************************/
+/*	Author: 	Gene Apperson											*/
+/*	Copyright 2013, Digilent Inc.										*/
+/************************************************************************/
+/*  Module Description: 												*/
+/*																		*/
+/*																		*/
+/************************************************************************/
+/*  Revision History:													*/
+/*																		*/
+/*	04/29/2011(GeneA): created for PmodOLED								*/
+/*	04/04/2013(JordanR):  Ported for Stellaris LaunchPad + Orbit BP		*/
+/*	06/06/2013(JordanR):  Prepared for release							*/
+/*																		*/
+/************************************************************************/
+
+
+/* ------------------------------------------------------------ */
+/*				Include File Definitions						*/
+/* ------------------------------------------------------------ */
+
+#include "delay.h"
+#include "LaunchPad.h"
+#include "OrbitBoosterPackDefs.h"
+
+/* ------------------------------------------------------------ */
+/*				Local Type Definitions							*/
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*				Global Variables								*/
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*				Local Variables									*/
+/* ------------------------------------------------------------ */
+
+/* Function to call when the pending asynchronous delay expires.
+*/
+void	(*pfnDelayDone)();
+
+
+/* ------------------------------------------------------------ */
+/*				Forward Declarations							*/
+/* ------------------------------------------------------------ */
+
+void	DelayIntHandler();
+
+
+/* ------------------------------------------------------------ */
+/*				Procedure Definitions							*/
+/* ------------------------------------------------------------ */
+/***	DelayInit
+**
+**	Parameters:
+**		none
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Initialized the hardware for use by delay functions. This
+**		initializes Timer 1 to count
+*/
+
+void
+DelayInit()	
+	{
+
+	/* Configure Timer 1. 
+	*/
+	SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+
+	TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC_UP);
+	TimerEnable(TIMER1_BASE, TIMER_A);
+
+	/* The timeout interrupt is used by DelayMsAsync.
+	*/
+	TimerIntRegister(TIMER1_BASE, TIMER_A, DelayIntHandler);
+	IntPrioritySet(INT_TIMER1A, INT_OLEDPriority);
+
+
+}
+
+/* ------------------------------------------------------------ */
+/***	DelayMs
+**
+**	Parameters:
+**		cms			- number of milliseconds to delay
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Delay the requested number of milliseconds. Uses Timer1.
+*/
+
+void
+DelayMs(int cms)
+	{
+	int		ims;
+
+	/* Put Timer 1 back to counting up in case it was last used
+	** for an asynchronous delay.
+	*/
+	TimerIntDisable(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+	TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC_UP);
+	TimerEnable(TIMER1_BASE, TIMER_A);
+
+	for (ims=0; ims<cms; ims++) {
+		/*
+		 * Clear Timer1
+		 */
+		HWREG(TIMER1_BASE + TIMER_O_TAV) = 0;
+		while (TimerValueGet(TIMER1_BASE, TIMER_A) < cntMsDelay);
+	}
+
+}		
+
+/* ------------------------------------------------------------ */
+/***	DelayMsAsync
+**
+**	Parameters:
+**		cms			- number of milliseconds to delay
+**		pfnDone		- function to call when the delay expires
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Start a delay of the requested number of milliseconds and
+**		return immediately. Timer 1 runs as a one shot and pfnDone
+**		is called from its interrupt when it times out. pfnDone may
+**		start another delay. Only one delay can be pending at a time.
+*/
+
+void
+DelayMsAsync(int cms, void (*pfnDone)())
+	{
+
+	TimerDisable(TIMER1_BASE, TIMER_A);
+	TimerConfigure(TIMER1_BASE, TIMER_CFG_ONE_SHOT);
+	TimerLoadSet(TIMER1_BASE, TIMER_A, cms * (SysCtlClockGet() / 1000));
+
+	pfnDelayDone = pfnDone;
+
+	TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+	TimerIntEnable(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+	TimerEnable(TIMER1_BASE, TIMER_A);
+
+}
+
+/* ------------------------------------------------------------ */
+/***	DelayIntHandler
+**
+**	Parameters:
+**		none
+**
+**	Return Value:
+**		none
+**
+**	Errors:
+**		none
+**
+**	Description:
+**		Timer 1 timeout interrupt handler. Ends the pending
+**		asynchronous delay and calls its completion function.
+*/
+
+void
+DelayIntHandler()
+	{
+	void	(*pfn)();
+
+	TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+	TimerIntDisable(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+
+	pfn = pfnDelayDone;
+	pfnDelayDone = 0;
+	if (pfn != 0) {
+		(*pfn)();
+	}
+
+}
+
+/* ------------------------------------------------------------ */
+/***	ProcName
+**
+**	Parameters:
+**
+**	Return Value:
+**
+**	Errors:
+**
+**	Description:
+**
+*/
+
+/* ------------------------------------------------------------ */
+
+/************************************************************************/
+
@@ -24,6 +24,7 @@
 #include "driverlib/systick.h"
 #include "driverlib/interrupt.h"
 #include "circBufT.h"
+#include "altitude.h"
 
 
 //*****************************************************************************
@@ -32,12 +33,17 @@
 //
 //*****************************************************************************
 circBuf_t g_inBuffer; // Buffer of size BUF_SIZE integers (sample values)
+volatile bool g_adcBlockReady = false; // A new block of samples is in the buffer
+static uint8_t g_blockCount = 0; // Samples since g_adcBlockReady was last set
 
 //*****************************************************************************
 //
 // The handler for the ADC conversion complete interrupt.
 // Gets a value from the ADC, places it in a circular buffer, and
-// then clears the interupt
+// then clears the interupt. Every ADC_BLOCK_SAMPLES samples the main
+// loop is told to recalculate the altitude. This is a flag rather than
+// an event, so blocks the main loop hasn't got to yet are taken together
+// instead of filling the event queue.
 //
 //*****************************************************************************
 
@@ -48,6 +54,11 @@ void ADCIntHandler(void)
     ADCSequenceDataGet(ADC0_BASE, 3, &ulValue);
     writeCircBuf(&g_inBuffer, ulValue);
     ADCIntClear(ADC0_BASE, 3);
+
+    if (++g_blockCount >= ADC_BLOCK_SAMPLES) {
+        g_blockCount = 0;
+        g_adcBlockReady = true;
+    }
 }
 
 //*****************************************************************************
@@ -27,8 +27,10 @@
 //
 // *******************************************************
 #define ALT_TICK_RATE_HZ 300
+#define ADC_BLOCK_SAMPLES 3 // Samples per g_adcBlockReady, 800 Hz / 3 is close to ALT_TICK_RATE_HZ
 
 extern circBuf_t g_inBuffer; // Buffer of size BUF_SIZE integers (sample values)
+extern volatile bool g_adcBlockReady; // Set by the ADC handler, cleared by the main loop
 
 //*****************************************************************************
 //
@@ -24,17 +24,95 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/debug.h"
 #include "inc/tm4c123gh6pm.h"  // Board specific defines (for PF0)
+#include "inputEvents.h"
 
 //*****************************************************************************
 //
 // Global variables
 //
+// The buttons are kept together, one bit per button (bit position given by
+// enum butNames), and debounced together with a two bit vertical counter: bit
+// i of but_count0 and but_count1 together count how many consecutive polls
+// button i has read opposite to its debounced state. An edge on a button
+// marks it active, and the buttons are only polled while one is active.
+//
 //*****************************************************************************
 
-static bool but_state[NUM_BUTS];	// Corresponds to the electrical state
-static uint8_t but_count[NUM_BUTS];
-static bool but_flag[NUM_BUTS];
-static bool but_normal[NUM_BUTS];   // Corresponds to the electrical state
+static uint32_t but_state;      // Debounced electrical state, HIGH = 1
+static uint32_t but_count0;     // Low bit of each button's poll counter
+static uint32_t but_count1;     // High bit of each button's poll counter
+static uint32_t but_active;     // Buttons with an edge not yet settled
+static uint32_t but_pollTime;   // inputTime() of the next poll
+static uint32_t but_presses;    // Buttons pushed since the last checkButton
+static uint32_t but_releases;   // Buttons released since the last checkButton
+static uint32_t but_repeats;    // Buttons that auto-repeated since the last checkButton
+static uint32_t but_repeatTime[NUM_BUTS];     // inputTime() of each held button's next repeat
+static uint32_t but_repeatInterval[NUM_BUTS]; // Ticks between each held button's repeats
+static uint32_t but_normal;     // Electrical state of each button when released
+
+// The two bit counters can count up to 3 polls
+#if NUM_BUT_POLLS != 3
+#error "pollButtons is written for NUM_BUT_POLLS of 3"
+#endif
+
+
+// *******************************************************
+//
+// pollButtons: Read all the buttons once and step their vertical
+// counters. A button's state changes only after NUM_BUT_POLLS
+// consecutive polls have read the pin in the opposite condition, at
+// which point its press or release bit is set. Buttons that agree with
+// their debounced state stop being active.
+//
+// *******************************************************
+static void
+pollButtons (uint32_t now)
+{
+	uint32_t sample;
+	uint32_t delta;
+	uint32_t toggle;
+	uint32_t leftRight;
+	uint32_t pushed;
+	uint8_t i;
+
+	// Read the pins into one word; a 1 means HIGH
+	leftRight = GPIOPinRead (LEFT_BUT_PORT_BASE, LEFT_BUT_PIN | RIGHT_BUT_PIN);
+	sample = ((GPIOPinRead (UP_BUT_PORT_BASE, UP_BUT_PIN) != 0) << UP) |
+	         ((GPIOPinRead (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN) != 0) << DOWN) |
+	         (((leftRight & LEFT_BUT_PIN) != 0) << LEFT) |
+	         (((leftRight & RIGHT_BUT_PIN) != 0) << RIGHT) |
+	         ((GPIOPinRead (RESET_BUT_PORT_BASE, RESET_BUT_PIN) != 0) << RESET);
+
+	// Count up the buttons that differ from their debounced state, and clear
+	// the count of those that agree
+	delta = sample ^ but_state;
+	but_count1 = (but_count1 ^ but_count0) & delta;
+	but_count0 = ~but_count0 & delta;
+
+	// Buttons whose count reached NUM_BUT_POLLS change state
+	toggle = but_count0 & but_count1;
+	but_state ^= toggle;
+	but_count0 &= ~toggle;
+	but_count1 &= ~toggle;
+
+	// Reset by call to checkButton()
+	pushed = toggle & (but_state ^ but_normal);
+	but_presses |= pushed;
+	but_releases |= toggle & ~(but_state ^ but_normal);
+
+	// A press starts the auto-repeat timing
+	for (i = 0; i < NUM_BUTS; i++)
+	{
+		if ((pushed >> i) & 1)
+		{
+			but_repeatTime[i] = now + INPUT_MS_TO_TICKS (BUT_REPEAT_DELAY_MS);
+			but_repeatInterval[i] = INPUT_MS_TO_TICKS (BUT_REPEAT_START_MS);
+		}
+	}
+
+	// Buttons still counting stay active; a later edge wakes the rest
+	but_active = but_count0 | but_count1;
+}
 
 
 // *******************************************************
@@ -46,34 +124,29 @@ static bool but_normal[NUM_BUTS];   // Corresponds to the electrical state
 void
 initButtons (void)
 {
-	int i;
 	// RESET button (active HIGH)
     SysCtlPeripheralEnable (RESET_BUT_PERIPH);
     GPIOPinTypeGPIOInput (RESET_BUT_PORT_BASE, RESET_BUT_PIN);
     GPIOPadConfigSet (RESET_BUT_PORT_BASE, RESET_BUT_PIN, GPIO_STRENGTH_2MA,
        GPIO_PIN_TYPE_STD_WPU);
-    but_normal[RESET] = RESET_BUT_NORMAL;
 
 	// UP button (active HIGH)
     SysCtlPeripheralEnable (UP_BUT_PERIPH);
     GPIOPinTypeGPIOInput (UP_BUT_PORT_BASE, UP_BUT_PIN);
     GPIOPadConfigSet (UP_BUT_PORT_BASE, UP_BUT_PIN, GPIO_STRENGTH_2MA,
        GPIO_PIN_TYPE_STD_WPD);
-    but_normal[UP] = UP_BUT_NORMAL;
 
 	// DOWN button (active HIGH)
     SysCtlPeripheralEnable (DOWN_BUT_PERIPH);
     GPIOPinTypeGPIOInput (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN);
     GPIOPadConfigSet (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN, GPIO_STRENGTH_2MA,
        GPIO_PIN_TYPE_STD_WPD);
-    but_normal[DOWN] = DOWN_BUT_NORMAL;
 
     // LEFT button (active LOW)
     SysCtlPeripheralEnable (LEFT_BUT_PERIPH);
     GPIOPinTypeGPIOInput (LEFT_BUT_PORT_BASE, LEFT_BUT_PIN);
     GPIOPadConfigSet (LEFT_BUT_PORT_BASE, LEFT_BUT_PIN, GPIO_STRENGTH_2MA,
        GPIO_PIN_TYPE_STD_WPU);
-    but_normal[LEFT] = LEFT_BUT_NORMAL;
 
     // RIGHT button (active LOW)
       // Note that PF0 is one of a handful of GPIO pins that need to be
@@ -87,57 +160,74 @@ initButtons (void)
     GPIOPinTypeGPIOInput (RIGHT_BUT_PORT_BASE, RIGHT_BUT_PIN);
     GPIOPadConfigSet (RIGHT_BUT_PORT_BASE, RIGHT_BUT_PIN, GPIO_STRENGTH_2MA,
        GPIO_PIN_TYPE_STD_WPU);
-    but_normal[RIGHT] = RIGHT_BUT_NORMAL;
 
-	for (i = 0; i < NUM_BUTS; i++)
-	{
-		but_state[i] = but_normal[i];
-		but_count[i] = 0;
-		but_flag[i] = false;
-	}
+    but_normal = (UP_BUT_NORMAL << UP) | (DOWN_BUT_NORMAL << DOWN) |
+                 (LEFT_BUT_NORMAL << LEFT) | (RIGHT_BUT_NORMAL << RIGHT) |
+                 (RESET_BUT_NORMAL << RESET);
+    but_state = but_normal;
+    but_count0 = 0;
+    but_count1 = 0;
+    but_active = 0;
+    but_presses = 0;
+    but_releases = 0;
+    but_repeats = 0;
 }
 
 // *******************************************************
 //
-// updateButtons: Function designed to be called regularly. It polls all
-// buttons once and updates variables associated with the buttons if
-// necessary.  It is efficient enough to be part of an ISR, e.g. from
-// a SysTick interrupt.
-// Debounce algorithm: A state machine is associated with each button.
-// A state change occurs only after NUM_BUT_POLLS consecutive polls have
-// read the pin in the opposite condition, before the state changes and
-// a flag is set.  NUM_BUT_POLLS is set according to the polling rate.
+// buttonEdge: Mark a button that had an edge as active. If no button was
+// active the buttons are polled on the next updateButtons, so a clean press
+// registers NUM_BUT_POLLS - 1 poll periods after its first edge.
+//
+// *******************************************************
+void
+buttonEdge (uint8_t butName, uint32_t time)
+{
+	if (but_active == 0)
+		but_pollTime = time;
+	but_active |= 1 << butName;
+}
+
+// *******************************************************
+//
+// updateButtons: Function designed to be called from the main loop. While
+// any button is active it polls all of them every BUT_POLL_MS.
+// Auto-repeat: A button in BUT_REPEAT_MASK held for BUT_REPEAT_DELAY_MS
+// starts repeating, first every BUT_REPEAT_START_MS and then faster on each
+// repeat, down to BUT_REPEAT_MIN_MS.
+// With no button active or held it does nothing.
 //
 // *******************************************************
 
 void
 updateButtons (void)
 {
-	bool but_value[NUM_BUTS];
-	int i;
-	
-	// Read the pins; true means HIGH, false means LOW
-	but_value[UP] = (GPIOPinRead (UP_BUT_PORT_BASE, UP_BUT_PIN) == UP_BUT_PIN);
-	but_value[DOWN] = (GPIOPinRead (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN) == DOWN_BUT_PIN);
-    but_value[LEFT] = (GPIOPinRead (LEFT_BUT_PORT_BASE, LEFT_BUT_PIN) == LEFT_BUT_PIN);
-    but_value[RIGHT] = (GPIOPinRead (RIGHT_BUT_PORT_BASE, RIGHT_BUT_PIN) == RIGHT_BUT_PIN);
-    but_value[RESET] = (GPIOPinRead (RESET_BUT_PORT_BASE, RESET_BUT_PIN) == RESET_BUT_PIN);
-
-	// Iterate through the buttons, updating button variables as required
+	uint32_t held;
+	uint32_t now;
+	uint8_t i;
+
+	held = (but_state ^ but_normal) & BUT_REPEAT_MASK;
+	if ((but_active | held) == 0)
+		return;
+
+	now = inputTime ();
+	if (but_active && ((int32_t) (now - but_pollTime) >= 0))
+	{
+		but_pollTime = now + INPUT_MS_TO_TICKS (BUT_POLL_MS);
+		pollButtons (now);
+		held = (but_state ^ but_normal) & BUT_REPEAT_MASK;
+	}
+
 	for (i = 0; i < NUM_BUTS; i++)
 	{
-        if (but_value[i] != but_state[i])
-        {
-        	but_count[i]++;
-        	if (but_count[i] >= NUM_BUT_POLLS)
-        	{
-        		but_state[i] = but_value[i];
-        		but_flag[i] = true;	   // Reset by call to checkButton()
-        		but_count[i] = 0;
-        	}
-        }
-        else
-        	but_count[i] = 0;
+		if (((held >> i) & 1) && ((int32_t) (now - but_repeatTime[i]) >= 0))
+		{
+			but_repeats |= 1 << i;	   // Reset by call to checkButton()
+			but_repeatTime[i] = now + but_repeatInterval[i];
+			but_repeatInterval[i] = (but_repeatInterval[i] * BUT_REPEAT_SPEEDUP) / 4;
+			if (but_repeatInterval[i] < INPUT_MS_TO_TICKS (BUT_REPEAT_MIN_MS))
+				but_repeatInterval[i] = INPUT_MS_TO_TICKS (BUT_REPEAT_MIN_MS);
+		}
 	}
 }
 
@@ -145,20 +235,28 @@ updateButtons (void)
 //
 // checkButton: Function returns the new button logical state if the button
 // logical state (PUSHED or RELEASED) has changed since the last call,
-// otherwise returns NO_CHANGE.
+// REPEATED if the button has been held long enough to auto-repeat since the
+// last call, otherwise returns NO_CHANGE. The bits are cleared through the
+// bit-band alias so this is safe against updateButtons running in an ISR.
 //
 // *******************************************************
 uint8_t
 checkButton (uint8_t butName)
 {
-	if (but_flag[butName])
+	if (((but_presses | but_releases) >> butName) & 1)
 	{
-		but_flag[butName] = false;
-		if (but_state[butName] == but_normal[butName])
-			return RELEASED;
-		else
+		HWREGBITW (&but_presses, butName) = 0;
+		HWREGBITW (&but_releases, butName) = 0;
+		HWREGBITW (&but_repeats, butName) = 0;
+		if (((but_state ^ but_normal) >> butName) & 1)
 			return PUSHED;
+		else
+			return RELEASED;
+	}
+	if ((but_repeats >> butName) & 1)
+	{
+		HWREGBITW (&but_repeats, butName) = 0;
+		return REPEATED;
 	}
 	return NO_CHANGE;
 }
-
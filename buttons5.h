@@ -28,10 +28,9 @@
 //
 //*****************************************************************************
 
-#define BUTTON_TICK_RATE_HZ 30
 
 enum butNames {UP = 0, DOWN, LEFT, RIGHT, RESET,NUM_BUTS};
-enum butStates {RELEASED = 0, PUSHED, NO_CHANGE};
+enum butStates {RELEASED = 0, PUSHED, NO_CHANGE, REPEATED};
 // UP button
 #define UP_BUT_PERIPH  SYSCTL_PERIPH_GPIOE
 #define UP_BUT_PORT_BASE  GPIO_PORTE_BASE
@@ -58,7 +57,15 @@ enum butStates {RELEASED = 0, PUSHED, NO_CHANGE};
 #define RESET_BUT_PIN  GPIO_PIN_6
 #define RESET_BUT_NORMAL  true
 
-#define NUM_BUT_POLLS 3 // NUM_BUT_POLLS set according to the polling rate.
+#define BUT_POLL_MS 10   // Poll period while a button is settling
+#define NUM_BUT_POLLS 3  // Consecutive opposite polls before a button changes state
+
+// Auto-repeat for held buttons
+#define BUT_REPEAT_MASK ((1 << UP) | (1 << DOWN) | (1 << LEFT) | (1 << RIGHT))
+#define BUT_REPEAT_DELAY_MS 500 // Hold time before the first repeat
+#define BUT_REPEAT_START_MS 250 // Time between the first repeats
+#define BUT_REPEAT_MIN_MS 60    // Fastest repeat
+#define BUT_REPEAT_SPEEDUP 3    // Each repeat interval is SPEEDUP/4 of the last
 
 // *******************************************************
 //
@@ -71,10 +78,19 @@ initButtons (void);
 
 // *******************************************************
 //
-// updateButtons: Function designed to be called regularly. It polls all
-// buttons once and updates variables associated with the buttons if
-// necessary.  It is efficient enough to be part of an ISR, e.g. from
-// a SysTick interrupt.
+// buttonEdge: Function designed to be called from the main loop for each
+// EVENT_BUTTON taken from the event queue (see eventQueue.h). It starts
+// debouncing the button; updateButtons does the rest.
+//
+// *******************************************************
+void
+buttonEdge (uint8_t butName, uint32_t time);
+
+// *******************************************************
+//
+// updateButtons: Function designed to be called from the main loop. It
+// polls the buttons while any is settling and auto-repeats held buttons.
+// It returns straight away when no button is changing or held.
 //
 // *******************************************************
 void
@@ -83,7 +99,8 @@ updateButtons (void);
 // *******************************************************
 //
 // checkButton: Function returns the new button state if the button state
-// (PUSHED or RELEASED) has changed since the last call, otherwise returns
+// (PUSHED or RELEASED) has changed since the last call, REPEATED if a held
+// button in BUT_REPEAT_MASK has auto-repeated, otherwise returns
 // NO_CHANGE.  The argument butName should be one of constants in the
 // enumeration butStates, excluding 'NUM_BUTS'. Safe under interrupt.
 //
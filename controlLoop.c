@@ -32,10 +32,10 @@ double g_dGainAltitude = 0.4;
 double g_pGainYaw = 4; // Yaw gains
 double g_iGainYaw = 0.3;
 double g_dGainYaw = 0.4;
-double g_errorIntMain = 0; // Errors
-double g_errorIntTail = 0;
-double errorPrevMain = 0;
-double errorPrevTail = 0;
+pidState_t g_pidMain = {0, 0, 0, 0, false, PWM_MIN_DUTY, PWM_MAX_DUTY_MAIN, 0,
+                        PID_FILTER_TIME(PID_D_CUTOFF_MAIN_HZ)}; // Controller states
+pidState_t g_pidTail = {0, 0, 0, 0, false, PWM_MIN_DUTY, PWM_MAX_DUTY_TAIL, 360,
+                        PID_FILTER_TIME(PID_D_CUTOFF_TAIL_HZ)};
 uint32_t g_controlAltitude = 0; // Control efforts
 uint32_t g_controlYaw = 0;
 double g_currentAngle = 0; // Current Values
@@ -44,54 +44,103 @@ int16_t g_setPointAlt = 0;
 int16_t g_setPointYaw = 0;
 int16_t g_baseLinePwmMain = 10; // Baseline PWM at initalistation
 int16_t g_baseLinePwmTail = 5;
+double g_tailFeedforwardGain = 0;  // Tail duty per main duty, found by calibrateMain
+double g_tailFeedforwardOffset = 0; // Tail duty at zero main duty, once found
+bool g_tailFeedforwardFound = false;
+
+// Sums for the least squares fit of tail duty against main duty
+static uint16_t g_fitCount = 0;
+static double g_fitSumMain = 0;
+static double g_fitSumTail = 0;
+static double g_fitSumMainSq = 0;
+static double g_fitSumMainTail = 0;
 
 
 // *******************************************************
 //
-// PID loop for the main motor which controls the altitude
+// PID kernel shared by both loops. The integral is kept in
+// percent duty. Back-calculation anti-windup: the gap
+// between the last output before limiting and the duty the
+// motor actually got (after this controller's limits, the
+// PWM layer's maximum and slew limit, or a fixed duty set
+// by the flight state) is fed back into the integral, so it
+// stops growing as soon as the motor can't follow and
+// unwinds at PID_TRACKING_GAIN.
+// The derivative is of the measurement rather than the
+// error, so set point steps don't kick the output, and is
+// low-pass filtered to keep sensor noise off the motors.
 //
 // *******************************************************
-uint32_t pidUpdateMain (double setpoint, double alt, double p, double i, double d, double dt){
-    double error = setpoint - alt;
-    double error_derivative = (error - errorPrevMain) / dt;
-    uint32_t control; // controller response
-
-    g_errorIntMain += error * dt;
-
-    // Setting limits on the integral error
-    if(g_errorIntMain > MAX_INT_CONTROL_MAIN){
-        g_errorIntMain = MAX_INT_CONTROL_MAIN;
+double pidUpdate (pidState_t *pid, double error, double measurement, double p, double i, double d,
+                  double offset, double applied, double dt){
+    double change = 0;
+    double control;
+
+    if (pid->primed) {
+        change = measurement - pid->prevMeasurement;
+        if (pid->wrap != 0) {
+            if (change > pid->wrap / 2) {
+                change -= pid->wrap;
+            } else if (change < -pid->wrap / 2) {
+                change += pid->wrap;
+            }
+        }
     }
+    pid->prevMeasurement = measurement;
+    pid->primed = true;
 
-    if(g_errorIntMain < -MAX_INT_CONTROL_MAIN){
-        g_errorIntMain = -MAX_INT_CONTROL_MAIN;
-    }
+    // First order low-pass filter on the rate of change
+    pid->rate += (change / dt - pid->rate) * dt / (pid->filterTime + dt);
+
+    pid->integral += (error * i + (applied - pid->output) * PID_TRACKING_GAIN) * dt;
 
     // Calculate control
-    control = error * p + g_errorIntMain * i + g_baseLinePwmMain + error_derivative * d;
+    pid->output = error * p + pid->integral - pid->rate * d + offset;
 
     // Cap control response
-    if(control <= PWM_MIN_DUTY){
-        control = PWM_MIN_DUTY;
+    control = pid->output;
+    if(control <= pid->outMin){
+        control = pid->outMin;
     }
 
-    if(control >= PWM_MAX_DUTY_MAIN){
-        control = PWM_MAX_DUTY_MAIN;
+    if(control >= pid->outMax){
+        control = pid->outMax;
     }
 
-    errorPrevMain = error;
     return control;
 }
 
+// *******************************************************
+//
+// PID loop for the main motor which controls the altitude.
+// The duty cycle is returned in tenths of a percent.
+//
+// *******************************************************
+uint32_t pidUpdateMain (double setpoint, double alt, uint32_t applied, double p, double i, double d, double dt){
+    return pidUpdate(&g_pidMain, setpoint - alt, alt, p, i, d, g_baseLinePwmMain,
+                     (double) applied / PWM_PERMILLE_PER_PERCENT, dt) * PWM_PERMILLE_PER_PERCENT;
+}
+
 // *******************************************************
 //
 // PID loop for the tail motor which controls the yaw and
-// counteracts rotation from the main rotor.
+// counteracts rotation from the main rotor. main_control is
+// the main duty in tenths of a percent; once calibrateMain
+// has found how much tail duty balances the main rotor's
+// torque that is fed forward, so the tail reacts to main
+// rotor changes before they turn the heli.
+// The duty cycle is returned in tenths of a percent.
 //
 // *******************************************************
-uint32_t pidUpdateTail (double setpoint, double yaw, double main_control, double p, double i, double d, double dt){
+uint32_t pidUpdateTail (double setpoint, double yaw, double main_control, uint32_t applied, double p, double i, double d, double dt){
+    const double measurement = yaw;
+    double feedforward = g_baseLinePwmTail;
     double error = 0;
 
+    if (g_tailFeedforwardFound) {
+        feedforward = g_tailFeedforwardOffset + g_tailFeedforwardGain * main_control / PWM_PERMILLE_PER_PERCENT;
+    }
+
     // Calculate error for yaw considering number space is -180 to 180
     // The series of if statements ensures that the shortest distance
     // is always used for the control response
@@ -109,50 +158,61 @@ uint32_t pidUpdateTail (double setpoint, double yaw, double main_control, double
         error = setpoint - yaw;
     }
 
-    double error_derivative = (error - errorPrevTail) / dt;
-
-    uint32_t control;
-
-    g_errorIntTail += error * dt;
-
-    // Setting limits on the integral error
-    if(g_errorIntTail > MAX_INT_CONTROL_TAIL){
-        g_errorIntTail = MAX_INT_CONTROL_TAIL;
-    }
-
-    if(g_errorIntTail < -MAX_INT_CONTROL_TAIL){
-        g_errorIntTail = -MAX_INT_CONTROL_TAIL;
-    }
+    return pidUpdate(&g_pidTail, error, measurement, p, i, d, feedforward,
+                     (double) applied / PWM_PERMILLE_PER_PERCENT, dt) * PWM_PERMILLE_PER_PERCENT;
+}
 
-    // Calculate control
-    control = error * p + g_errorIntTail * i + error_derivative * d + g_baseLinePwmTail;
+// *******************************************************
+//
+// Least squares straight line through the tail duty needed
+// at each main duty seen while calibrating. The fit is only
+// used if it spans enough main duties and its slope is
+// believable.
+//
+// *******************************************************
+static void fitTailFeedforward(void){
+    const double spread = g_fitCount * g_fitSumMainSq - g_fitSumMain * g_fitSumMain;
+    double gain;
 
-    // Cap control response
-    if(control <= PWM_MIN_DUTY){
-        control = PWM_MIN_DUTY;
+    if ((g_fitCount < TAIL_FF_MIN_SAMPLES) || (spread <= 0)) {
+        return;
     }
 
-    if(control >= PWM_MAX_DUTY_TAIL){
-            control = PWM_MAX_DUTY_TAIL;
+    gain = (g_fitCount * g_fitSumMainTail - g_fitSumMain * g_fitSumTail) / spread;
+    if ((gain < 0) || (gain > TAIL_FF_MAX_GAIN)) {
+        return;
     }
 
-    errorPrevTail = error;
-    return control;
+    g_tailFeedforwardGain = gain;
+    g_tailFeedforwardOffset = (g_fitSumTail - gain * g_fitSumMain) / g_fitCount;
+    g_tailFeedforwardFound = true;
 }
 
 // *******************************************************
 //
 // Code for calibrating the main rotor by determining the
-// duty cycle needed to just begin to lift
+// duty cycle needed to just begin to lift. Each step also
+// records the tail duty holding the heading against the
+// main rotor's torque, for the tail feedforward.
 //
 // *******************************************************
 enum state calibrateMain(void){
+    const double mainDuty = (double) getMainPWMDuty() / PWM_PERMILLE_PER_PERCENT;
+    const double tailDuty = (double) getTailPWMDuty() / PWM_PERMILLE_PER_PERCENT;
+
     if(g_percentAltitude <= 1){
+        g_fitCount++;
+        g_fitSumMain += mainDuty;
+        g_fitSumTail += tailDuty;
+        g_fitSumMainSq += mainDuty * mainDuty;
+        g_fitSumMainTail += mainDuty * tailDuty;
+
         g_baseLinePwmMain += 1;
-        g_errorIntMain = 0;
-        g_baseLinePwmTail = g_controlYaw;
+        g_pidMain.integral = 0;
+        g_baseLinePwmTail = g_controlYaw / PWM_PERMILLE_PER_PERCENT;
         return CALIBRATE_ALT;
     } else {
+        fitTailFeedforward();
         return CALIBRATE_YAW;
     }
 }
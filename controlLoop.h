@@ -25,40 +25,78 @@
 //
 // *******************************************************
 
-#define MAX_INT_CONTROL_MAIN 200
-#define MAX_INT_CONTROL_TAIL 200
+#define PID_TRACKING_GAIN 2.0 // 1/s, how fast the integral unwinds while the motor can't follow
+#define PID_D_CUTOFF_MAIN_HZ 10 // Cut-off of the filter on the derivative terms
+#define PID_D_CUTOFF_TAIL_HZ 20
+#define TAIL_FF_MIN_SAMPLES 4 // Calibration steps needed to fit the tail feedforward
+#define TAIL_FF_MAX_GAIN 1.5  // Steeper fits are taken to be noise
+#define PID_FILTER_TIME(hz) (1.0 / (2 * 3.14159265 * (hz))) // Filter time constant, s
 #define PROPORTIONAL_PWM_ANGLE_RANGE 24
 
+// State of one PID loop. Duties are in percent.
+typedef struct {
+    double integral;    // Integral term
+    double output;      // Last output before limiting
+    double rate;        // Filtered rate of change of the measurement, per s
+    double prevMeasurement;
+    bool primed;        // prevMeasurement has been set
+    double outMin;      // Output limits
+    double outMax;
+    double wrap;        // Range the measurement wraps over, 0 if it doesn't
+    double filterTime;  // Time constant of the derivative filter, s
+} pidState_t;
+
 extern double g_pGainAltitude;
 extern double g_iGainAltitude;
 extern double g_dGainAltitude;
 extern double g_pGainYaw;
 extern double g_iGainYaw;
 extern double g_dGainYaw;
-extern double g_errorIntMain;
-extern double g_errorIntTail;
-extern uint32_t g_controlAltitude;
+extern pidState_t g_pidMain;
+extern pidState_t g_pidTail;
+extern uint32_t g_controlAltitude; // Tenths of a percent duty
 extern uint32_t g_controlYaw;
 extern double g_currentAngle;
 extern int16_t g_percentAltitude;
 extern int16_t g_setPointAlt;
 extern int16_t g_setPointYaw;
+extern double g_tailFeedforwardGain;
+extern double g_tailFeedforwardOffset;
+extern bool g_tailFeedforwardFound;
+
+// *******************************************************
+//
+// PID kernel shared by both loops. The derivative term
+// acts on the filtered rate of change of measurement.
+// applied is the duty the motor got after the last update,
+// used to stop the integral winding up. Returns the limited
+// output in percent duty.
+//
+// *******************************************************
+double
+pidUpdate (pidState_t *pid, double error, double measurement, double p, double i, double d,
+           double offset, double applied, double dt);
 
 // *******************************************************
 //
-// PID loop for the main motor which controls the altitude
+// PID loop for the main motor which controls the altitude.
+// applied is the duty the PWM layer gave the motor for the
+// last output, after its maximum and slew limit. Returns
+// the duty cycle in tenths of a percent.
 //
 // *******************************************************
 uint32_t
-pidUpdateMain (double setpoint, double alt, double p, double i, double d, double dt);
+pidUpdateMain (double setpoint, double alt, uint32_t applied, double p, double i, double d, double dt);
 // *******************************************************
 
 // PID loop for the tail motor which controls the yaw and
-// counteracts rotation from the main rotor.
+// counteracts rotation from the main rotor. applied is as
+// for pidUpdateMain. Returns the duty cycle in tenths of a
+// percent.
 //
 // *******************************************************
 uint32_t
-pidUpdateTail (double setpoint, double yaw, double main_control, double p, double i, double d, double dt);
+pidUpdateTail (double setpoint, double yaw, double main_control, uint32_t applied, double p, double i, double d, double dt);
 
 // *******************************************************
 //
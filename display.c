@@ -3,7 +3,8 @@
 // display.c
 //
 // Supports the OrbitOLED display. It shows Altitude in %, Angle
-// in degrees, and the main and rear PWM duty cycles
+// in degrees, and the main and rear PWM duty cycles, or a scrolling
+// strip chart of altitude and yaw error
 //
 // Authors: Luke Roeven (ljr83)
 //          Anahita Piri (api48)
@@ -14,44 +15,253 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "driverlib/interrupt.h"
+#include <string.h>
 #include "OrbitOLED/OrbitOLEDInterface.h"
 #include "OrbitOLED/lib_OrbitOled/OrbitOled.h"
+#include "OrbitOLED/lib_OrbitOled/OrbitOledGrph.h"
+#include "display.h"
 #include "quadrature.h"
 #include "controlLoop.h"
 
 
 //*****************************************************************************
 //
-// Function to initialise the Orbit OLED display
+// Numeric fields. Each one is a fixed-width, right-aligned integer at a
+// character position on the display. The characters currently shown are kept
+// so only the digits that change are redrawn.
+//
+//*****************************************************************************
+#define NUM_FIELD_MAX_WIDTH 6
+
+typedef struct {
+    uint8_t column;                     // Character column of the first digit
+    uint8_t row;                        // Character row
+    uint8_t width;                      // Number of characters in the field
+    char shown[NUM_FIELD_MAX_WIDTH];    // Characters currently in the framebuffer
+} numField_t;
+
+static numField_t mainPWMField = {7, 0, 3, {0}};
+static numField_t tailPWMField = {7, 1, 3, {0}};
+static numField_t altitudeField = {10, 2, 3, {0}};
+static numField_t angleField = {8, 3, 4, {0}};
+
+
+//*****************************************************************************
+//
+// Strip chart layout. Altitude (0 - 100 %) is plotted on the top two pages
+// and yaw error on the bottom two, centred on CHART_YAW_ZERO_ROW and clipped
+// at +/- CHART_YAW_MAX_OFFSET rows. The newest sample is drawn in the
+// rightmost column and older samples scroll off to the left.
+//
+//*****************************************************************************
+#define CHART_ALT_TOP_ROW 0
+#define CHART_ALT_BOTTOM_ROW 15
+#define CHART_YAW_ZERO_ROW 24
+#define CHART_YAW_MAX_OFFSET 7
+#define CHART_YAW_DEG_PER_ROW 4
+#define CHART_AXIS_SPACING 4    // Columns between dots of the yaw zero line
+#define CHART_NO_SAMPLE -1
+
+static displayPage_t g_displayPage = VALUES_PAGE;
+static int8_t g_chartAltRow = CHART_NO_SAMPLE;     // Row of the previous altitude sample
+static int8_t g_chartYawRow = CHART_NO_SAMPLE;     // Row of the previous yaw error sample
+static uint8_t g_chartColumnCount = 0;
+
+
+//*****************************************************************************
+//
+// Draws a value into a numeric field. Digits are generated right to left and
+// only the characters that differ from what is already shown are rendered.
+// A value that does not fit is shown as a row of '*'.
+//
+//*****************************************************************************
+static void
+drawNumField (numField_t *field, int32_t value)
+{
+    char text[NUM_FIELD_MAX_WIDTH];
+    uint32_t magnitude = (value < 0) ? -(uint32_t) value : (uint32_t) value;
+    int8_t i = field->width - 1;
+
+    do {
+        text[i--] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0 && i >= 0);
+
+    if (value < 0) {
+        if (i >= 0) {
+            text[i--] = '-';
+        } else {
+            magnitude = 1;
+        }
+    }
+
+    while (i >= 0) {
+        text[i--] = ' ';
+    }
+
+    for (i = 0; i < field->width; i++) {
+        if (magnitude != 0) {
+            text[i] = '*';
+        }
+        if (text[i] != field->shown[i]) {
+            OLEDCharDraw (text[i], field->column + i, field->row);
+            field->shown[i] = text[i];
+        }
+    }
+}
+
+
+//*****************************************************************************
+//
+// Draws the labels of the values page and forgets what the numeric fields
+// were showing, so every digit is drawn on the next refresh
+//
+//*****************************************************************************
+static void
+drawValuesPage (void)
+{
+    OLEDStringDraw ("PWM: M", 0, 0);
+    OLEDStringDraw ("PWM: T", 0, 1);
+    OLEDStringDraw ("Altitude:    %", 0, 2);
+    OLEDStringDraw ("Angle =", 0, 3);
+
+    memset (mainPWMField.shown, 0, NUM_FIELD_MAX_WIDTH);
+    memset (tailPWMField.shown, 0, NUM_FIELD_MAX_WIDTH);
+    memset (altitudeField.shown, 0, NUM_FIELD_MAX_WIDTH);
+    memset (angleField.shown, 0, NUM_FIELD_MAX_WIDTH);
+}
+
+
+//*****************************************************************************
+//
+// Draws one trace of the strip chart into the newest column, joining the
+// previous sample to this one so fast changes show as a continuous line
+//
+//*****************************************************************************
+static void
+drawChartSample (int8_t previousRow, int8_t row)
+{
+    if (previousRow == CHART_NO_SAMPLE) {
+        previousRow = row;
+    }
+    OrbitOledMoveTo (ccolOledMax - 1, previousRow);
+    OrbitOledLineTo (ccolOledMax - 1, row);
+    OrbitOledDrawPixel ();
+}
+
+
+//*****************************************************************************
+//
+// Function to initialise the Orbit OLED display and draw the labels, which
+// never change after this
 //
 //*****************************************************************************
 void
 initDisplay (void)
 {
     OLEDInitialise ();
+
+    OLEDBeginFrame ();
+    drawValuesPage ();
+    OLEDEndFrame ();
 }
 
+
 //*****************************************************************************
 //
-// Function to display the PWM duty cycle for the main and tail rotor, the percentage altitude
-// and the current yaw angle.
+// Function to switch between the values page and the strip chart page
+//
+//*****************************************************************************
+void
+toggleDisplayPage (void)
+{
+    OLEDBeginFrame ();
+    OrbitOledClearBuffer ();
+
+    if (g_displayPage == VALUES_PAGE) {
+        g_displayPage = CHART_PAGE;
+        g_chartAltRow = CHART_NO_SAMPLE;
+        g_chartYawRow = CHART_NO_SAMPLE;
+        OrbitOledSetDrawMode (modOledSet);
+        OrbitOledSetDrawColor (1);
+    } else {
+        g_displayPage = VALUES_PAGE;
+        drawValuesPage ();
+    }
+
+    OLEDEndFrame ();
+}
+
+
+//*****************************************************************************
+//
+// Function to add a sample to the strip chart. The chart pages are scrolled
+// one column left and only the new column is drawn; the scroll marks just the
+// columns that changed, so only the traces are sent to the display.
 //
 //*****************************************************************************
-void screenDisplay(uint16_t g_percentAltitude, double g_currentAngle, uint8_t g_dispMainPWM, uint8_t g_dispTailPWM){
-    char string[17];  // 16 characters across the display
+void
+chartDisplay (int16_t percentAltitude, int16_t yawError)
+{
+    int8_t altRow;
+    int8_t yawRow;
+
+    if (g_displayPage != CHART_PAGE) {
+        return;
+    }
+
+    if (percentAltitude < 0) {
+        percentAltitude = 0;
+    } else if (percentAltitude > 100) {
+        percentAltitude = 100;
+    }
+    altRow = CHART_ALT_BOTTOM_ROW -
+             (percentAltitude * (CHART_ALT_BOTTOM_ROW - CHART_ALT_TOP_ROW) + 50) / 100;
+
+    yawError /= CHART_YAW_DEG_PER_ROW;
+    if (yawError > CHART_YAW_MAX_OFFSET) {
+        yawError = CHART_YAW_MAX_OFFSET;
+    } else if (yawError < -CHART_YAW_MAX_OFFSET) {
+        yawError = -CHART_YAW_MAX_OFFSET;
+    }
+    yawRow = CHART_YAW_ZERO_ROW - yawError;
 
+    OrbitOledScrollLeft (0, cpagOledMax - 1);
 
-    usnprintf (string, sizeof(string), "PWM: M %3d", (int) g_dispMainPWM);
-    OLEDStringDraw (string, 0, 0);
+    // Dotted zero line for the yaw error trace
+    g_chartColumnCount++;
+    if (g_chartColumnCount >= CHART_AXIS_SPACING) {
+        g_chartColumnCount = 0;
+        OrbitOledMoveTo (ccolOledMax - 1, CHART_YAW_ZERO_ROW);
+        OrbitOledDrawPixel ();
+    }
 
-    usnprintf (string, sizeof(string), "PWM: T %3d", (int) g_dispTailPWM);
-    OLEDStringDraw (string, 0, 1);
+    drawChartSample (g_chartAltRow, altRow);
+    drawChartSample (g_chartYawRow, yawRow);
+    g_chartAltRow = altRow;
+    g_chartYawRow = yawRow;
+
+    OrbitOledUpdate ();
+}
+
+//*****************************************************************************
+//
+// Function to display the PWM duty cycle for the main and tail rotor, the percentage altitude
+// and the current yaw angle.
+//
+//*****************************************************************************
+void screenDisplay(int32_t g_percentAltitude, double g_currentAngle, uint8_t g_dispMainPWM, uint8_t g_dispTailPWM){
+    if (g_displayPage != VALUES_PAGE) {
+        return;
+    }
 
-    usnprintf (string, sizeof(string), "Altitude: %3d%%", (int) g_percentAltitude);
-    OLEDStringDraw (string, 0, 2);
+    // Redraw the changed digits into the framebuffer, then flush once
+    OLEDBeginFrame ();
 
-    usnprintf (string, sizeof(string), "Angle = %4d", (int) g_currentAngle);
-    OLEDStringDraw (string, 0, 3);
+    drawNumField (&mainPWMField, g_dispMainPWM);
+    drawNumField (&tailPWMField, g_dispTailPWM);
+    drawNumField (&altitudeField, g_percentAltitude);
+    drawNumField (&angleField, (int32_t) g_currentAngle);
 
+    OLEDEndFrame ();
 }
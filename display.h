@@ -24,6 +24,9 @@
 //
 //*****************************************************************************
 #define DISP_TICK_RATE_HZ 2 // poll display at 2 HZ
+#define CHART_TICK_RATE_HZ 30 // add a strip chart sample at 30 Hz
+
+typedef enum {VALUES_PAGE = 0, CHART_PAGE} displayPage_t;
 
 
 //*****************************************************************************
@@ -41,6 +44,23 @@ initDisplay (void);
 //
 //*****************************************************************************
 void
-screenDisplay(uint16_t g_percentAltitude, double g_currentAngle, uint8_t dispMainPWM, uint8_t dispTailPWM);
+screenDisplay(int32_t g_percentAltitude, double g_currentAngle, uint8_t dispMainPWM, uint8_t dispTailPWM);
+
+//*****************************************************************************
+//
+// Function to switch the display between the values page and the strip chart
+//
+//*****************************************************************************
+void
+toggleDisplayPage (void);
+
+//*****************************************************************************
+//
+// Function to add the latest altitude (%) and yaw error (degrees) to the strip
+// chart. Does nothing while the values page is shown.
+//
+//*****************************************************************************
+void
+chartDisplay (int16_t percentAltitude, int16_t yawError);
 
 #endif /*DISPLAY_H_*/
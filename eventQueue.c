@@ -0,0 +1,108 @@
+// *******************************************************
+//
+// eventQueue.c
+//
+// Multi-producer, single-consumer event queue. Producers are
+// interrupt handlers, which can pre-empt each other, so a slot
+// is reserved by advancing the write index with LDREX/STREX:
+// if another handler posts between the two the store fails and
+// the reservation is retried. The event is then written into
+// the slot. A handler finishes its post before anything it
+// pre-empted carries on, and the main loop only runs with no
+// handler active, so by the time the main loop sees the new
+// write index every reserved slot has been filled.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eventQueue.h"
+#include "inputEvents.h"
+
+#define EVENT_INDEX_MASK (EVENT_QUEUE_SIZE - 1)
+
+//*****************************************************************************
+//
+// Global variables
+//
+//*****************************************************************************
+static volatile uint32_t g_eventWindex;    // Next slot to reserve, changed by the handlers
+static volatile uint32_t g_eventRindex;    // Next slot to read, only changed by the main loop
+static volatile uint32_t g_eventDrops;     // Events dropped with the queue full
+static event_t g_events[EVENT_QUEUE_SIZE];
+
+
+void
+initEventQueue (void)
+{
+    g_eventWindex = g_eventRindex = 0;
+    g_eventDrops = 0;
+}
+
+
+//*****************************************************************************
+//
+// The exclusive monitor is cleared on every exception entry and return, so a
+// handler that pre-empts another between its LDREX and STREX makes the
+// pre-empted STREX fail, and it goes round again with the new index. A full
+// queue leaves without a store, so the reservation is cleared with CLREX first.
+//
+//*****************************************************************************
+bool
+postEvent (uint8_t type, uint8_t input, bool level)
+{
+    uint32_t windex;
+    uint32_t drops;
+    event_t *slot;
+
+    do {
+        windex = __ldrex ((void *) &g_eventWindex);
+        if (windex - g_eventRindex >= EVENT_QUEUE_SIZE) {
+            __clrex ();
+            do {
+                drops = __ldrex ((void *) &g_eventDrops);
+            } while (__strex (drops + 1, (void *) &g_eventDrops) != 0);
+            return false;
+        }
+    } while (__strex (windex + 1, (void *) &g_eventWindex) != 0);
+
+    slot = &g_events[windex & EVENT_INDEX_MASK];
+    slot->time = inputTime ();
+    slot->type = type;
+    slot->input = input;
+    slot->level = level;
+    return true;
+}
+
+
+uint32_t
+eventsDropped (void)
+{
+    return g_eventDrops;
+}
+
+
+bool
+readEvent (event_t *event)
+{
+    uint32_t rindex = g_eventRindex;
+
+    if (rindex == g_eventWindex) {
+        return false;
+    }
+
+    *event = g_events[rindex & EVENT_INDEX_MASK];
+    g_eventRindex = rindex + 1;
+    return true;
+}
+
+
+bool
+eventPending (void)
+{
+    return g_eventWindex != g_eventRindex;
+}
@@ -0,0 +1,99 @@
+// *******************************************************
+//
+// eventQueue.h
+//
+// Queue of events posted by the interrupt handlers for the
+// main loop: the yaw reference being seen, and button and
+// switch edges. Any
+// handler may post, whatever its priority, and only the main
+// loop reads, so the interrupts pass on what happened and the
+// main loop makes the state changes in the order they
+// happened.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#ifndef EVENTQUEUE_H_
+#define EVENTQUEUE_H_
+
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+// Constants
+//
+//*****************************************************************************
+// The longest the main loop goes without reading the queue is a UART status
+// line, about 100 ms at 9600 baud. In that time each of the five buttons and
+// the switch can be pressed and released, with bounce, and the yaw reference
+// passed: 6 inputs of up to 10 edges each and one reference event fit in 64.
+#define EVENT_QUEUE_SIZE 64     // Must be a power of two
+
+// Event types
+enum eventTypes {EVENT_YAW_REF = 0, EVENT_BUTTON, EVENT_SWITCH};
+
+//*****************************************************************************
+//
+// An event from an interrupt handler
+//
+//*****************************************************************************
+typedef struct {
+    uint32_t time;  // inputTime() when the event was posted
+    uint8_t type;   // One of enum eventTypes
+    uint8_t input;  // Button (enum butNames) for EVENT_BUTTON, otherwise unused
+    bool level;     // Pin level after the edge for EVENT_BUTTON and EVENT_SWITCH
+} event_t;
+
+//*****************************************************************************
+//
+// initEventQueue: Empty the queue. Call before enabling the interrupts that
+// post to it.
+//
+//*****************************************************************************
+void
+initEventQueue (void);
+
+//*****************************************************************************
+//
+// postEvent: Add an event stamped with inputTime(). Safe to call from any
+// interrupt handler. Returns false, dropping the event and counting it in
+// eventsDropped(), if the queue is full.
+//
+//*****************************************************************************
+bool
+postEvent (uint8_t type, uint8_t input, bool level);
+
+//*****************************************************************************
+//
+// eventsDropped: Returns how many events have been dropped because the queue
+// was full since initEventQueue.
+//
+//*****************************************************************************
+uint32_t
+eventsDropped (void);
+
+//*****************************************************************************
+//
+// readEvent: Take the oldest event. Returns false if there is none. Only the
+// main loop may call this.
+//
+//*****************************************************************************
+bool
+readEvent (event_t *event);
+
+//*****************************************************************************
+//
+// eventPending: Returns true if the queue is not empty. Call with interrupts
+// disabled before sleeping, so an event posted after the check wakes the
+// processor instead of waiting for the next interrupt.
+//
+//*****************************************************************************
+bool
+eventPending (void);
+
+#endif /* EVENTQUEUE_H_ */
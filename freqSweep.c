@@ -0,0 +1,108 @@
+// *******************************************************
+//
+// freqSweep.c
+//
+// Characterisation of the main rotor's PWM frequency. At
+// each step the altitude is left to settle for
+// SWEEP_SETTLE_MS and then averaged for SWEEP_MEASURE_MS.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "utils/ustdlib.h"
+#include "pwm.h"
+#include "uart.h"
+#include "freqSweep.h"
+
+#define SWEEP_SETTLE_TICKS (SWEEP_SETTLE_MS * SWEEP_TICK_RATE_HZ / 1000)
+#define SWEEP_MEASURE_TICKS (SWEEP_MEASURE_MS * SWEEP_TICK_RATE_HZ / 1000)
+
+//*****************************************************************************
+//
+// Global variables
+//
+//*****************************************************************************
+static volatile bool g_sweepActive = false;
+static volatile uint32_t g_sweepDuty;   // Tenths of a percent
+static uint32_t g_sweepFreq;            // Frequency being measured
+static uint32_t g_sweepSavedFreq;       // Main frequency before the sweep
+static uint16_t g_sweepTicks;           // Ticks at the current frequency
+static int32_t g_sweepAltSum;           // Altitude total over the measurement
+
+
+void
+startSweep (uint32_t ui32Duty)
+{
+    if (!g_sweepActive) {
+        g_sweepSavedFreq = getMainPWMFreq ();
+    }
+    g_sweepFreq = PWM_RATE_MIN_HZ;
+    g_sweepTicks = 0;
+    g_sweepAltSum = 0;
+    g_sweepDuty = ui32Duty * PWM_PERMILLE_PER_PERCENT;
+    setMainPWMFreq (g_sweepFreq);
+    g_sweepActive = true;
+}
+
+
+void
+stopSweep (void)
+{
+    if (g_sweepActive) {
+        g_sweepActive = false;
+        setMainPWMFreq (g_sweepSavedFreq);
+    }
+}
+
+
+bool
+sweepActive (void)
+{
+    return g_sweepActive;
+}
+
+
+uint32_t
+sweepDutyPermille (void)
+{
+    return g_sweepDuty;
+}
+
+
+void
+updateSweep (int16_t percentAltitude)
+{
+    if (!g_sweepActive) {
+        return;
+    }
+
+    g_sweepTicks++;
+    if (g_sweepTicks <= SWEEP_SETTLE_TICKS) {
+        return;
+    }
+
+    g_sweepAltSum += percentAltitude;
+    if (g_sweepTicks < SWEEP_SETTLE_TICKS + SWEEP_MEASURE_TICKS) {
+        return;
+    }
+
+    usprintf (g_statusStr, "SWEEP F=%3d D=%2d ALT=%3d\r\n",
+              (int) g_sweepFreq, (int) (g_sweepDuty / PWM_PERMILLE_PER_PERCENT),
+              (int) (g_sweepAltSum / SWEEP_MEASURE_TICKS));
+    UARTSend (g_statusStr);
+
+    g_sweepFreq += PWM_RATE_STEP_HZ;
+    if (g_sweepFreq > PWM_RATE_MAX_HZ) {
+        stopSweep ();
+        UARTSend ("SWEEP DONE\r\n");
+        return;
+    }
+    setMainPWMFreq (g_sweepFreq);
+    g_sweepTicks = 0;
+    g_sweepAltSum = 0;
+}
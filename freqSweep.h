@@ -0,0 +1,66 @@
+// *******************************************************
+//
+// freqSweep.h
+//
+// Characterisation of the main rotor's PWM frequency. The
+// main rotor is held at a fixed duty cycle while its PWM
+// frequency is stepped from PWM_RATE_MIN_HZ to
+// PWM_RATE_MAX_HZ, and the altitude reached at each
+// frequency is sent over UART.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#ifndef FREQSWEEP_H_
+#define FREQSWEEP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// *******************************************************
+//
+// Constants
+//
+// *******************************************************
+#define SWEEP_TICK_RATE_HZ 10
+#define SWEEP_SETTLE_MS 3000  // Time at each frequency before measuring
+#define SWEEP_MEASURE_MS 1000 // Time the altitude is averaged over after that
+
+// *******************************************************
+//
+// Start a sweep with the main rotor at ui32Duty percent,
+// or stop one early. Stopping puts the main rotor back on
+// the frequency it had before the sweep.
+//
+// *******************************************************
+void
+startSweep (uint32_t ui32Duty);
+
+void
+stopSweep (void);
+
+// *******************************************************
+//
+// Returns true while a sweep is running, and the duty
+// cycle it holds the main rotor at in tenths of a percent
+//
+// *******************************************************
+bool
+sweepActive (void);
+
+uint32_t
+sweepDutyPermille (void);
+
+// *******************************************************
+//
+// Called at SWEEP_TICK_RATE_HZ with the current altitude.
+// Sends a line for each frequency as it is measured.
+//
+// *******************************************************
+void
+updateSweep (int16_t percentAltitude);
+
+#endif /* FREQSWEEP_H_ */
@@ -0,0 +1,86 @@
+// *******************************************************
+//
+// gainSchedule.c
+//
+// Altitude PID gains scheduled on altitude. Each control
+// tick finds the segment the altitude is in and adds the
+// segment's precomputed slope times the distance into it,
+// so the cost is one multiply per gain.
+//
+// The gains at each altitude are tuned by hovering there
+// with fixed gains, stepping the set point by ALT_STEP both
+// ways and adjusting until the steps settle without
+// overshoot, logging the UART output. Write the results as
+// lines of "altitude,p,i,d" and run tools/gaintable over
+// them to produce g_altitudeGainPoints below. Points need
+// not be at the scheduled altitudes; the tool interpolates.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "controlLoop.h"
+#include "gainSchedule.h"
+
+//*****************************************************************************
+//
+// Gains at 0%, 25%, 50%, 75% and 100% altitude, as produced by tools/gaintable
+// from gainTuning.csv. Only the original fixed tuning is in there so far, so
+// the schedule is flat until more altitudes are tuned and added to the file.
+//
+//*****************************************************************************
+static const gainSet_t g_altitudeGainPoints[GAIN_SCHEDULE_POINTS] = {
+    {1.20, 0.20, 0.40},
+    {1.20, 0.20, 0.40},
+    {1.20, 0.20, 0.40},
+    {1.20, 0.20, 0.40},
+    {1.20, 0.20, 0.40},
+};
+
+//*****************************************************************************
+//
+// Global variables
+//
+//*****************************************************************************
+static gainSet_t g_altitudeGainSlopes[GAIN_SCHEDULE_POINTS - 1]; // Change per percent
+
+
+void
+initGainSchedule (void)
+{
+    uint8_t k;
+
+    for (k = 0; k < GAIN_SCHEDULE_POINTS - 1; k++) {
+        g_altitudeGainSlopes[k].p = (g_altitudeGainPoints[k + 1].p - g_altitudeGainPoints[k].p) / GAIN_SCHEDULE_STEP;
+        g_altitudeGainSlopes[k].i = (g_altitudeGainPoints[k + 1].i - g_altitudeGainPoints[k].i) / GAIN_SCHEDULE_STEP;
+        g_altitudeGainSlopes[k].d = (g_altitudeGainPoints[k + 1].d - g_altitudeGainPoints[k].d) / GAIN_SCHEDULE_STEP;
+    }
+}
+
+
+void
+scheduleAltitudeGains (int16_t percentAltitude)
+{
+    uint8_t k;
+    int16_t offset;
+
+    if (percentAltitude < 0) {
+        percentAltitude = 0;
+    } else if (percentAltitude > 100) {
+        percentAltitude = 100;
+    }
+
+    k = percentAltitude / GAIN_SCHEDULE_STEP;
+    if (k > GAIN_SCHEDULE_POINTS - 2) {
+        k = GAIN_SCHEDULE_POINTS - 2;
+    }
+    offset = percentAltitude - k * GAIN_SCHEDULE_STEP;
+
+    g_pGainAltitude = g_altitudeGainPoints[k].p + g_altitudeGainSlopes[k].p * offset;
+    g_iGainAltitude = g_altitudeGainPoints[k].i + g_altitudeGainSlopes[k].i * offset;
+    g_dGainAltitude = g_altitudeGainPoints[k].d + g_altitudeGainSlopes[k].d * offset;
+}
@@ -0,0 +1,57 @@
+// *******************************************************
+//
+// gainSchedule.h
+//
+// Altitude PID gains scheduled on altitude. The rotor's
+// thrust is far from linear in duty, so gains that suit the
+// heli near the ground are too strong near the top. Gains
+// are set at evenly spaced altitudes and interpolated
+// between them.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#ifndef GAINSCHEDULE_H_
+#define GAINSCHEDULE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// *******************************************************
+//
+// Constants
+//
+// *******************************************************
+#define GAIN_SCHEDULE_POINTS 5 // Altitudes with gains set, from 0% to 100%
+#define GAIN_SCHEDULE_STEP (100 / (GAIN_SCHEDULE_POINTS - 1)) // Percent between them
+
+// One set of PID gains
+typedef struct {
+    double p;
+    double i;
+    double d;
+} gainSet_t;
+
+// *******************************************************
+//
+// Works out the change in each gain per percent altitude
+// between the set altitudes. Call once before the control
+// loop starts.
+//
+// *******************************************************
+void
+initGainSchedule (void);
+
+// *******************************************************
+//
+// Sets g_pGainAltitude, g_iGainAltitude and g_dGainAltitude
+// for the given altitude. Called each control tick.
+//
+// *******************************************************
+void
+scheduleAltitudeGains (int16_t percentAltitude);
+
+#endif /* GAINSCHEDULE_H_ */
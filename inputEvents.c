@@ -0,0 +1,147 @@
+// *******************************************************
+//
+// inputEvents.c
+//
+// Edge interrupts for the buttons and the flight mode switch.
+// Each port with a button or the switch on it has one handler,
+// which posts an event for each pin that changed, with its new
+// level, to the event queue read by the main loop.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "buttons5.h"
+#include "switches.h"
+#include "inputEvents.h"
+#include "eventQueue.h"
+
+//*****************************************************************************
+//
+// Global variables
+//
+//*****************************************************************************
+static volatile uint32_t g_inputTime = 0;
+
+
+//*****************************************************************************
+//
+// Edge interrupt handlers, one for each port. Port A has both the RESET
+// button and the switch.
+//
+//*****************************************************************************
+void
+inputPortAIntHandler (void)
+{
+    uint32_t status = GPIOIntStatus (GPIO_PORTA_BASE, true);
+    uint32_t level;
+
+    GPIOIntClear (GPIO_PORTA_BASE, status);
+    level = GPIOPinRead (GPIO_PORTA_BASE, RESET_BUT_PIN | SW1_PIN);
+
+    if (status & RESET_BUT_PIN) {
+        postEvent (EVENT_BUTTON, RESET, (level & RESET_BUT_PIN) != 0);
+    }
+    if (status & SW1_PIN) {
+        postEvent (EVENT_SWITCH, 0, (level & SW1_PIN) != 0);
+    }
+}
+
+void
+inputPortDIntHandler (void)
+{
+    uint32_t status = GPIOIntStatus (DOWN_BUT_PORT_BASE, true);
+
+    GPIOIntClear (DOWN_BUT_PORT_BASE, status);
+    if (status & DOWN_BUT_PIN) {
+        postEvent (EVENT_BUTTON, DOWN,
+                   GPIOPinRead (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN) != 0);
+    }
+}
+
+void
+inputPortEIntHandler (void)
+{
+    uint32_t status = GPIOIntStatus (UP_BUT_PORT_BASE, true);
+
+    GPIOIntClear (UP_BUT_PORT_BASE, status);
+    if (status & UP_BUT_PIN) {
+        postEvent (EVENT_BUTTON, UP,
+                   GPIOPinRead (UP_BUT_PORT_BASE, UP_BUT_PIN) != 0);
+    }
+}
+
+void
+inputPortFIntHandler (void)
+{
+    uint32_t status = GPIOIntStatus (GPIO_PORTF_BASE, true);
+    uint32_t level;
+
+    GPIOIntClear (GPIO_PORTF_BASE, status);
+    level = GPIOPinRead (GPIO_PORTF_BASE, LEFT_BUT_PIN | RIGHT_BUT_PIN);
+
+    if (status & LEFT_BUT_PIN) {
+        postEvent (EVENT_BUTTON, LEFT, (level & LEFT_BUT_PIN) != 0);
+    }
+    if (status & RIGHT_BUT_PIN) {
+        postEvent (EVENT_BUTTON, RIGHT, (level & RIGHT_BUT_PIN) != 0);
+    }
+}
+
+
+//*****************************************************************************
+//
+// Initialisation of the edge interrupts
+//
+//*****************************************************************************
+void
+initInputEvents (void)
+{
+    GPIOIntRegister (GPIO_PORTA_BASE, inputPortAIntHandler);
+    GPIOIntRegister (DOWN_BUT_PORT_BASE, inputPortDIntHandler);
+    GPIOIntRegister (UP_BUT_PORT_BASE, inputPortEIntHandler);
+    GPIOIntRegister (GPIO_PORTF_BASE, inputPortFIntHandler);
+
+    GPIOIntTypeSet (GPIO_PORTA_BASE, RESET_BUT_PIN | SW1_PIN, GPIO_BOTH_EDGES);
+    GPIOIntTypeSet (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN, GPIO_BOTH_EDGES);
+    GPIOIntTypeSet (UP_BUT_PORT_BASE, UP_BUT_PIN, GPIO_BOTH_EDGES);
+    GPIOIntTypeSet (GPIO_PORTF_BASE, LEFT_BUT_PIN | RIGHT_BUT_PIN, GPIO_BOTH_EDGES);
+
+    IntPrioritySet (INT_GPIOA, INPUT_INT_PRIORITY);
+    IntPrioritySet (INT_GPIOD, INPUT_INT_PRIORITY);
+    IntPrioritySet (INT_GPIOE, INPUT_INT_PRIORITY);
+    IntPrioritySet (INT_GPIOF, INPUT_INT_PRIORITY);
+
+    GPIOIntClear (GPIO_PORTA_BASE, RESET_BUT_PIN | SW1_PIN);
+    GPIOIntClear (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN);
+    GPIOIntClear (UP_BUT_PORT_BASE, UP_BUT_PIN);
+    GPIOIntClear (GPIO_PORTF_BASE, LEFT_BUT_PIN | RIGHT_BUT_PIN);
+
+    GPIOIntEnable (GPIO_PORTA_BASE, RESET_BUT_PIN | SW1_PIN);
+    GPIOIntEnable (DOWN_BUT_PORT_BASE, DOWN_BUT_PIN);
+    GPIOIntEnable (UP_BUT_PORT_BASE, UP_BUT_PIN);
+    GPIOIntEnable (GPIO_PORTF_BASE, LEFT_BUT_PIN | RIGHT_BUT_PIN);
+}
+
+
+void
+inputTick (void)
+{
+    g_inputTime++;
+}
+
+
+uint32_t
+inputTime (void)
+{
+    return g_inputTime;
+}
@@ -0,0 +1,59 @@
+// *******************************************************
+//
+// inputEvents.h
+//
+// Edge interrupts for the buttons and the flight mode switch.
+// Every edge on one of their pins is posted to the event queue
+// (see eventQueue.h), stamped with the time it happened, for the
+// button or switch code to debounce, so nothing has to poll the
+// pins while they are idle.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#ifndef INPUTEVENTS_H_
+#define INPUTEVENTS_H_
+
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+// Constants
+//
+//*****************************************************************************
+#define INPUT_TICK_RATE_HZ 800  // inputTick is called from the SysTick handler
+#define INPUT_MS_TO_TICKS(ms) (((ms) * INPUT_TICK_RATE_HZ + 999) / 1000)
+#define INPUT_INT_PRIORITY 0xA0 // Behind the control and quadrature interrupts
+
+//*****************************************************************************
+//
+// initInputEvents: Set up and enable the edge interrupts. Call after
+// initButtons and initSwitch have configured the pins and initEventQueue has
+// emptied the queue.
+//
+//*****************************************************************************
+void
+initInputEvents (void);
+
+//*****************************************************************************
+//
+// inputTick: Advance the input time base. Called once per SysTick.
+//
+//*****************************************************************************
+void
+inputTick (void);
+
+//*****************************************************************************
+//
+// inputTime: Returns the input time base, in units of 1/INPUT_TICK_RATE_HZ
+//
+//*****************************************************************************
+uint32_t
+inputTime (void);
+
+#endif /* INPUTEVENTS_H_ */
@@ -29,6 +29,29 @@
 #include "driverlib/debug.h"
 #include "pwm.h"
 
+//*****************************************************************************
+//
+// One motor's PWM output. The period for the output's frequency is worked out
+// only when the frequency changes. The duty cycle is kept in millionths
+// (thousandths of the per-mille duty) so slew rates that are a fraction of a
+// per-mille per update still add up.
+//
+//*****************************************************************************
+typedef struct {
+    uint32_t base;      // PWM module
+    uint32_t gen;       // Generator in the module
+    uint32_t outNum;    // Output of the generator
+    volatile uint32_t newFreq; // Frequency asked for by setMainPWMFreq/setTailPWMFreq
+    uint32_t freq;      // Frequency the period was set for, 0 until first set
+    uint32_t period;    // Period in PWM clock counts
+    uint32_t maxDuty;   // Highest duty cycle, tenths of a percent
+    volatile uint32_t slewStep; // Largest change per update in millionths, 0 = no limit
+    uint32_t duty;      // Duty cycle applied, millionths
+    volatile int32_t excess;    // Duty asked for less duty applied, tenths of a percent
+} pwmOutput_t;
+
+#define PWM_MICRO_PER_PERMILLE 1000
+
 //*****************************************************************************
 //
 // Global variables
@@ -38,23 +61,108 @@
 uint8_t g_dispTailPWM = 0;
 uint8_t g_dispMainPWM = 0;
 
+static uint32_t g_pwmClock; // PWM clock rate, read once by initialisePWM
+static pwmOutput_t g_mainOutput = {PWM_MAIN_BASE, PWM_MAIN_GEN, PWM_MAIN_OUTNUM, PWM_START_RATE_HZ, 0, 0,
+                                   PWM_MAX_DUTY_MAIN * PWM_PERMILLE_PER_PERCENT,
+                                   PWM_SLEW_STEP (PWM_SLEW_MAIN_PERMILLE_PER_S), 0, 0};
+static pwmOutput_t g_tailOutput = {PWM_TAIL_BASE, PWM_TAIL_GEN, PWM_TAIL_OUTNUM, PWM_START_RATE_HZ, 0, 0,
+                                   PWM_MAX_DUTY_TAIL * PWM_PERMILLE_PER_PERCENT,
+                                   PWM_SLEW_STEP (PWM_SLEW_TAIL_PERMILLE_PER_S), 0, 0};
+
+// *******************************************************
+//
+// Moves an output's duty cycle towards the one asked for,
+// in tenths of a percent, no further than its maximum and
+// its slew limit allow. Returns the duty cycle applied.
+//
+// *******************************************************
+static uint32_t
+limitPWMOutput (pwmOutput_t *output, uint32_t ui32Permille)
+{
+    const uint32_t ui32Step = output->slewStep;
+    uint32_t ui32Target;
+
+    if (ui32Permille > output->maxDuty) {
+        ui32Permille = output->maxDuty;
+    }
+    ui32Target = ui32Permille * PWM_MICRO_PER_PERMILLE;
+
+    if ((ui32Step == 0) || (ui32Target + ui32Step >= output->duty && ui32Target <= output->duty + ui32Step)) {
+        output->duty = ui32Target;
+    } else if (ui32Target > output->duty) {
+        output->duty += ui32Step;
+    } else {
+        output->duty -= ui32Step;
+    }
+
+    return output->duty / PWM_MICRO_PER_PERMILLE;
+}
+
+// *******************************************************
+//
+// Sets an output's pulse width for a duty cycle given in
+// tenths of a percent, changing its period first if a new
+// frequency has been asked for. Both are loaded together
+// by syncPWM, so the change is glitch free. Returns the
+// duty cycle applied after limiting.
+//
+// *******************************************************
+static uint32_t
+setPWMOutput (pwmOutput_t *output, uint32_t ui32Permille)
+{
+    const uint32_t ui32Freq = output->newFreq;
+    const uint32_t ui32Applied = limitPWMOutput (output, ui32Permille);
+
+    output->excess = (int32_t) ui32Permille - (int32_t) ui32Applied;
+
+    if (ui32Freq != output->freq) {
+        output->freq = ui32Freq;
+        output->period = g_pwmClock / ui32Freq;
+        PWMGenPeriodSet(output->base, output->gen, output->period);
+    }
+
+    PWMPulseWidthSet(output->base, output->outNum,
+        output->period * ui32Applied / PWM_DUTY_SCALE);
+    return ui32Applied;
+}
+
+// *******************************************************
+//
+// Asks for a new frequency for an output, if it is in range.
+// In up/down mode the generator counts to half the period,
+// which has to fit its 16 bit load register.
+//
+// *******************************************************
+static bool
+setPWMFreq (pwmOutput_t *output, uint32_t ui32Freq)
+{
+    if ((ui32Freq < PWM_RATE_MIN_HZ) || (ui32Freq > PWM_RATE_MAX_HZ)) {
+        return false;
+    }
+    if (g_pwmClock / ui32Freq / 2 > PWM_MAX_LOAD) {
+        return false;
+    }
+    output->newFreq = ui32Freq;
+    return true;
+}
+
 // *******************************************************
 //
 // Function sets the main PWM rotor duty cycle
 //
 // *******************************************************
 void
-setMainPWM (uint32_t ui32Freq, uint32_t ui32Duty)
+setMainPWM (uint32_t ui32Duty)
 {
-    // Calculate the PWM period corresponding to the freq.
-    uint32_t ui32Period =
-        SysCtlClockGet() / PWM_DIVIDER / ui32Freq;
-
-    PWMGenPeriodSet(PWM_MAIN_BASE, PWM_MAIN_GEN, ui32Period);
-    PWMPulseWidthSet(PWM_MAIN_BASE, PWM_MAIN_OUTNUM,
-        ui32Period * ui32Duty / 100);
-    g_dispMainPWM = ui32Duty;
+    setMainPWMPermille (ui32Duty * PWM_PERMILLE_PER_PERCENT);
+}
 
+uint32_t
+setMainPWMPermille (uint32_t ui32Permille)
+{
+    const uint32_t ui32Applied = setPWMOutput (&g_mainOutput, ui32Permille);
+    g_dispMainPWM = (ui32Applied + PWM_PERMILLE_PER_PERCENT / 2) / PWM_PERMILLE_PER_PERCENT;
+    return ui32Applied;
 }
 
 // *******************************************************
@@ -63,16 +171,113 @@ setMainPWM (uint32_t ui32Freq, uint32_t ui32Duty)
 //
 // *******************************************************
 void
-setTailPWM (uint32_t ui32Freq, uint32_t ui32Duty)
+setTailPWM (uint32_t ui32Duty)
+{
+    setTailPWMPermille (ui32Duty * PWM_PERMILLE_PER_PERCENT);
+}
+
+uint32_t
+setTailPWMPermille (uint32_t ui32Permille)
+{
+    const uint32_t ui32Applied = setPWMOutput (&g_tailOutput, ui32Permille);
+    g_dispTailPWM = (ui32Applied + PWM_PERMILLE_PER_PERCENT / 2) / PWM_PERMILLE_PER_PERCENT;
+    return ui32Applied;
+}
+
+// *******************************************************
+//
+// Functions change and report the motors' PWM frequencies
+//
+// *******************************************************
+bool
+setMainPWMFreq (uint32_t ui32Freq)
+{
+    return setPWMFreq (&g_mainOutput, ui32Freq);
+}
+
+bool
+setTailPWMFreq (uint32_t ui32Freq)
+{
+    return setPWMFreq (&g_tailOutput, ui32Freq);
+}
+
+uint32_t
+getMainPWMFreq (void)
+{
+    return g_mainOutput.freq;
+}
+
+uint32_t
+getTailPWMFreq (void)
+{
+    return g_tailOutput.freq;
+}
+
+// *******************************************************
+//
+// Functions set how fast a motor's duty cycle may change
+//
+// *******************************************************
+void
+setMainPWMSlew (uint32_t ui32PermillePerSec)
+{
+    g_mainOutput.slewStep = PWM_SLEW_STEP (ui32PermillePerSec);
+}
+
+void
+setTailPWMSlew (uint32_t ui32PermillePerSec)
+{
+    g_tailOutput.slewStep = PWM_SLEW_STEP (ui32PermillePerSec);
+}
+
+// *******************************************************
+//
+// Functions report how far the last duty cycle written
+// fell short of the one asked for
+//
+// *******************************************************
+int32_t
+getMainPWMSaturation (void)
+{
+    return g_mainOutput.excess;
+}
+
+int32_t
+getTailPWMSaturation (void)
+{
+    return g_tailOutput.excess;
+}
+
+// *******************************************************
+//
+// Functions return the duty cycle applied to a motor
+//
+// *******************************************************
+uint32_t
+getMainPWMDuty (void)
 {
-    // Calculate the PWM period corresponding to the freq.
-    uint32_t ui32Period = SysCtlClockGet() / PWM_DIVIDER / ui32Freq;
+    return g_mainOutput.duty / PWM_MICRO_PER_PERMILLE;
+}
 
-    PWMGenPeriodSet(PWM_TAIL_BASE, PWM_TAIL_GEN, ui32Period);
-    PWMPulseWidthSet(PWM_TAIL_BASE, PWM_TAIL_OUTNUM,
-        ui32Period * ui32Duty / 100);
-    g_dispTailPWM = ui32Duty;
+uint32_t
+getTailPWMDuty (void)
+{
+    return g_tailOutput.duty / PWM_MICRO_PER_PERMILLE;
+}
 
+// *******************************************************
+//
+// Loads the periods and pulse widths set since the last
+// call into both generators. Each generator takes them at
+// its next zero count, so a cycle never mixes old and new
+// values.
+//
+// *******************************************************
+void
+syncPWM (void)
+{
+    PWMSyncUpdate(PWM_MAIN_BASE, PWM_MAIN_GEN_BIT);
+    PWMSyncUpdate(PWM_TAIL_BASE, PWM_TAIL_GEN_BIT);
 }
 
 // *******************************************************
@@ -83,6 +288,9 @@ setTailPWM (uint32_t ui32Freq, uint32_t ui32Duty)
 void
 initialisePWM (void)
 {
+    SysCtlPWMClockSet(PWM_DIVIDER_CODE);
+    g_pwmClock = SysCtlClockGet() / PWM_DIVIDER;
+
     // Initialisation for Main PWM
     SysCtlPeripheralEnable(PWM_MAIN_PERIPH_PWM);
     SysCtlPeripheralEnable(PWM_MAIN_PERIPH_GPIO);
@@ -91,9 +299,9 @@ initialisePWM (void)
     GPIOPinTypePWM(PWM_MAIN_GPIO_BASE, PWM_MAIN_GPIO_PIN);
 
     PWMGenConfigure(PWM_MAIN_BASE, PWM_MAIN_GEN,
-                    PWM_GEN_MODE_UP_DOWN | PWM_GEN_MODE_NO_SYNC);
+                    PWM_GEN_MODE_UP_DOWN | PWM_GEN_MODE_SYNC | PWM_GEN_MODE_GEN_SYNC_GLOBAL);
 
-    setMainPWM (PWM_START_RATE_HZ, PWM_FIXED_DUTY); // Set the initial PWM parameters
+    setMainPWM (PWM_FIXED_DUTY); // Set the initial PWM parameters
 
     PWMGenEnable(PWM_MAIN_BASE, PWM_MAIN_GEN);
 
@@ -107,11 +315,13 @@ initialisePWM (void)
     GPIOPinTypePWM(PWM_TAIL_GPIO_BASE, PWM_TAIL_GPIO_PIN);
 
     PWMGenConfigure(PWM_TAIL_BASE, PWM_TAIL_GEN,
-                    PWM_GEN_MODE_UP_DOWN | PWM_GEN_MODE_NO_SYNC);
+                    PWM_GEN_MODE_UP_DOWN | PWM_GEN_MODE_SYNC | PWM_GEN_MODE_GEN_SYNC_GLOBAL);
 
-    setMainPWM (PWM_START_RATE_HZ, PWM_FIXED_DUTY);    // Set the initial PWM parameters
+    setTailPWM (PWM_FIXED_DUTY);    // Set the initial PWM parameters
 
     PWMGenEnable(PWM_TAIL_BASE, PWM_TAIL_GEN);
 
     PWMOutputState(PWM_TAIL_BASE, PWM_TAIL_OUTBIT, false);
+
+    syncPWM ();
 }
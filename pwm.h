@@ -47,13 +47,21 @@
 #define PWM_MAX_DUTY_MAIN  80
 #define PWM_MAX_DUTY_TAIL  70
 #define PWM_DIVIDER_CODE   SYSCTL_PWMDIV_4
-#define PWM_DIVIDER        1
+#define PWM_DIVIDER        4
+#define PWM_MAX_LOAD       0xFFFF // Generator load register is 16 bits
 #define PWM_TICK_RATE_HZ 30 // Ouzput PWM at 30 HZ
+#define PWM_DUTY_SCALE     1000 // Fine duty cycles are in tenths of a percent
+#define PWM_PERMILLE_PER_PERCENT (PWM_DUTY_SCALE / 100)
+#define PWM_UPDATE_RATE_HZ 800  // Duty cycles are written once per SysTick
+#define PWM_SLEW_MAIN_PERMILLE_PER_S 500  // Fastest duty cycle change, 0 = no limit
+#define PWM_SLEW_TAIL_PERMILLE_PER_S 1000
+#define PWM_SLEW_STEP(rate) ((rate) * 1000 / PWM_UPDATE_RATE_HZ) // Change per update, millionths
 
 //  PWM Hardware Details M0PWM7 (gen 3)
 //  ---Main Rotor PWM: PC5, J4-05
 #define PWM_MAIN_BASE        PWM0_BASE
 #define PWM_MAIN_GEN         PWM_GEN_3
+#define PWM_MAIN_GEN_BIT     PWM_GEN_3_BIT
 #define PWM_MAIN_OUTNUM      PWM_OUT_7
 #define PWM_MAIN_OUTBIT      PWM_OUT_7_BIT
 #define PWM_MAIN_PERIPH_PWM  SYSCTL_PERIPH_PWM0
@@ -66,6 +74,7 @@
 //  ---Tail Rotor PWM: PF1, J3-10
 #define PWM_TAIL_BASE        PWM1_BASE
 #define PWM_TAIL_GEN         PWM_GEN_2
+#define PWM_TAIL_GEN_BIT     PWM_GEN_2_BIT
 #define PWM_TAIL_OUTNUM      PWM_OUT_5
 #define PWM_TAIL_OUTBIT      PWM_OUT_5_BIT
 #define PWM_TAIL_PERIPH_PWM  SYSCTL_PERIPH_PWM1
@@ -79,19 +88,108 @@ extern uint8_t g_dispMainPWM;
 
 // *******************************************************
 //
-// Function sets the main PWM rotor duty cycle
+// Function sets the main PWM rotor duty cycle, in percent
+// or in tenths of a percent (Permille), subject to the
+// motor's maximum and slew limit. The period is only
+// recalculated when the frequency changes. The Permille
+// version returns the duty cycle applied.
 //
 // *******************************************************
 void
-setMainPWM (uint32_t ui32Freq, uint32_t ui32Duty);
+setMainPWM (uint32_t ui32Duty);
+
+uint32_t
+setMainPWMPermille (uint32_t ui32Permille);
+
+// *******************************************************
+//
+// Function sets the rear PWM rotor duty cycle, in percent
+// or in tenths of a percent (Permille). The Permille
+// version returns the duty cycle applied.
+//
+// *******************************************************
+void
+setTailPWM (uint32_t ui32Duty);
+
+uint32_t
+setTailPWMPermille (uint32_t ui32Permille);
+
+// *******************************************************
+//
+// Functions change a motor's PWM frequency. Returns false
+// if the frequency is outside PWM_RATE_MIN_HZ to
+// PWM_RATE_MAX_HZ. The new period is loaded with the next
+// duty cycle, so the change happens between PWM cycles.
+//
+// *******************************************************
+bool
+setMainPWMFreq (uint32_t ui32Freq);
+
+bool
+setTailPWMFreq (uint32_t ui32Freq);
+
+// *******************************************************
+//
+// Functions return a motor's PWM frequency, as set by the
+// last duty cycle update. A new frequency asked for takes
+// effect from the next update.
+//
+// *******************************************************
+uint32_t
+getMainPWMFreq (void);
+
+uint32_t
+getTailPWMFreq (void);
+
+// *******************************************************
+//
+// Functions set how fast a motor's duty cycle may change,
+// in tenths of a percent per second. 0 removes the limit.
+// The highest duty cycles are PWM_MAX_DUTY_MAIN and
+// PWM_MAX_DUTY_TAIL.
+//
+// *******************************************************
+void
+setMainPWMSlew (uint32_t ui32PermillePerSec);
+
+void
+setTailPWMSlew (uint32_t ui32PermillePerSec);
+
+// *******************************************************
+//
+// Functions return the duty cycle last asked for less the
+// one applied, in tenths of a percent. Positive when the
+// motor is held below what the controller wants by its
+// maximum or slew limit, negative when held above it.
+//
+// *******************************************************
+int32_t
+getMainPWMSaturation (void);
+
+int32_t
+getTailPWMSaturation (void);
+
+// *******************************************************
+//
+// Functions return the duty cycle applied to a motor, in
+// tenths of a percent
+//
+// *******************************************************
+uint32_t
+getMainPWMDuty (void);
+
+uint32_t
+getTailPWMDuty (void);
 
 // *******************************************************
 //
-// Function sets the rear PWM rotor duty cycle
+// Function loads the duty cycles and periods set since the
+// last call at the start of the next PWM cycle. Nothing set
+// reaches the outputs until this is called.
 //
 // *******************************************************
 void
-setTailPWM (uint32_t ui32Freq, uint32_t ui32Duty);
+syncPWM (void);
 
 // *******************************************************
 //
@@ -1,81 +1,118 @@
-// *******************************************************
-//
-// switches.c
-//
-// Setup of the switch on the board to control flight and
-// landing mode.
-//
-// Authors: Luke Roeven (ljr83)
-//          Anahita Piri (api48)
-//          Maggie Booker (meb139)
-//
-// *******************************************************
-
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "inc/hw_memmap.h"
-#include "inc/hw_types.h"
-#include "driverlib/gpio.h"
-#include "driverlib/sysctl.h"
-#include "driverlib/debug.h"
-#include "inc/tm4c123gh6pm.h"  // Board specific defines (for PF0)
-#include "switches.h"
-
-//*****************************************************************************
-//
-// Global variables
-//
-//*****************************************************************************
-
-bool g_switch_state;
-bool g_newg_switch_state;
-bool g_switch_stateChanged = false;
-
-// *******************************************************
-//
-// Initialisation of the switch GPIO
-//
-// *******************************************************
-void initSwitch() {
-    SysCtlPeripheralEnable(SW1_PERIPH);
-    GPIOPinTypeGPIOInput(SW1_PORT_BASE, SW1_PIN);
-    GPIOPadConfigSet(SW1_PORT_BASE, SW1_PIN, GPIO_STRENGTH_2MA,
-                     GPIO_PIN_TYPE_STD_WPD);
-    g_switch_state = GPIOPinRead(SW1_PORT_BASE, SW1_PIN)
-                      == SW1_PIN;
-}
-
-// *******************************************************
-//
-// Update of the switch peripheral to see if its state
-// has changed.
-//
-// *******************************************************
-void updateSwitch(void) {
-     g_newg_switch_state = GPIOPinRead(SW1_PORT_BASE, SW1_PIN)
-                              == SW1_PIN;
-    if (g_newg_switch_state != g_switch_state) {
-        g_switch_stateChanged = true;
-    }
-    g_switch_state = g_newg_switch_state;
-}
-
-// *******************************************************
-//
-// Checking of the switch to determine its new state, or
-// if it is unchanged.
-//
-// *******************************************************
-uint8_t checkSwitch() {
-    if (g_switch_stateChanged) {
-        g_switch_stateChanged = false;
-        if (g_switch_state) {
-            return SWITCH_UP;
-        } else {
-            return SWITCH_DOWN;
-        }
-    } else {
-        return UNCHANGED;
-    }
-}
+// *******************************************************
+//
+// switches.c
+//
+// Setup of the switch on the board to control flight and
+// landing mode.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/debug.h"
+#include "inc/tm4c123gh6pm.h"  // Board specific defines (for PF0)
+#include "switches.h"
+#include "inputEvents.h"
+
+//*****************************************************************************
+//
+// Global variables
+//
+//*****************************************************************************
+
+bool g_switch_state;
+bool g_switch_stateChanged = false;
+static bool g_switch_locked = false;   // Still inside the debounce time
+static uint32_t g_switch_lockTime;     // inputTime() of the last change
+
+// *******************************************************
+//
+// Initialisation of the switch GPIO
+//
+// *******************************************************
+void initSwitch() {
+    SysCtlPeripheralEnable(SW1_PERIPH);
+    GPIOPinTypeGPIOInput(SW1_PORT_BASE, SW1_PIN);
+    GPIOPadConfigSet(SW1_PORT_BASE, SW1_PIN, GPIO_STRENGTH_2MA,
+                     GPIO_PIN_TYPE_STD_WPD);
+    g_switch_state = GPIOPinRead(SW1_PORT_BASE, SW1_PIN)
+                      == SW1_PIN;
+}
+
+// *******************************************************
+//
+// Flip the debounced switch state and start the debounce time
+//
+// *******************************************************
+static void changeSwitch(uint32_t time) {
+    g_switch_state = !g_switch_state;
+    g_switch_stateChanged = true;
+    g_switch_locked = true;
+    g_switch_lockTime = time;
+}
+
+// *******************************************************
+//
+// Update of the switch state from an edge taken from the
+// event queue. The first edge that changes the state is
+// taken straight away and edges in the SWITCH_DEBOUNCE_MS
+// after it are ignored.
+//
+// *******************************************************
+void switchEdge(bool level, uint32_t time) {
+    if (g_switch_locked &&
+        ((int32_t) (time - g_switch_lockTime) < INPUT_MS_TO_TICKS(SWITCH_DEBOUNCE_MS))) {
+        return;
+    }
+    g_switch_locked = false;
+    if (level != g_switch_state) {
+        changeSwitch(time);
+    }
+}
+
+// *******************************************************
+//
+// End of the debounce time. When it is up the pin is read
+// once in case the switch settled at the other level.
+//
+// *******************************************************
+void updateSwitch(void) {
+    uint32_t now;
+
+    if (g_switch_locked) {
+        now = inputTime();
+        if (now - g_switch_lockTime >= INPUT_MS_TO_TICKS(SWITCH_DEBOUNCE_MS)) {
+            g_switch_locked = false;
+            if ((GPIOPinRead(SW1_PORT_BASE, SW1_PIN) == SW1_PIN) != g_switch_state) {
+                changeSwitch(now);
+            }
+        }
+    }
+}
+// *******************************************************
+//
+// Checking of the switch to determine its new state, or
+// if it is unchanged.
+//
+// *******************************************************
+uint8_t checkSwitch() {
+    if (g_switch_stateChanged) {
+        g_switch_stateChanged = false;
+        if (g_switch_state) {
+            return SWITCH_UP;
+        } else {
+            return SWITCH_DOWN;
+        }
+    } else {
+        return UNCHANGED;
+    }
+}
@@ -0,0 +1,104 @@
+// *******************************************************
+//
+// gaintable.c
+//
+// Turns altitude gains tuned at any set of altitudes into
+// the g_altitudeGainPoints table in gainSchedule.c. Reads
+// lines of "altitude,p,i,d" (altitude in percent) from
+// standard input, interpolates them to the
+// GAIN_SCHEDULE_POINTS evenly spaced altitudes, holding the
+// end values beyond the lowest and highest tuned altitude,
+// and prints the table ready to paste in. Lines that don't
+// parse, such as a header or comments, are skipped.
+//
+// Build and run from the top of the repository with:
+//
+//   gcc -I . -o gaintable tools/gaintable/gaintable.c
+//   ./gaintable < tuned.csv
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "gainSchedule.h"
+
+#define MAX_TUNED 64
+#define MAX_LINE 128
+
+typedef struct {
+    double altitude;
+    gainSet_t gains;
+} tunedPoint_t;
+
+static int
+compareAltitude (const void *a, const void *b)
+{
+    const double altA = ((const tunedPoint_t *) a)->altitude;
+    const double altB = ((const tunedPoint_t *) b)->altitude;
+
+    return (altA > altB) - (altA < altB);
+}
+
+// *******************************************************
+//
+// Gains at an altitude, from the tuned points either side
+//
+// *******************************************************
+static gainSet_t
+interpolate (const tunedPoint_t *tuned, int count, double altitude)
+{
+    gainSet_t gains;
+    double frac;
+    int k;
+
+    if (altitude <= tuned[0].altitude) {
+        return tuned[0].gains;
+    }
+    if (altitude >= tuned[count - 1].altitude) {
+        return tuned[count - 1].gains;
+    }
+
+    for (k = 0; tuned[k + 1].altitude < altitude; k++) {
+    }
+    frac = (altitude - tuned[k].altitude) / (tuned[k + 1].altitude - tuned[k].altitude);
+    gains.p = tuned[k].gains.p + frac * (tuned[k + 1].gains.p - tuned[k].gains.p);
+    gains.i = tuned[k].gains.i + frac * (tuned[k + 1].gains.i - tuned[k].gains.i);
+    gains.d = tuned[k].gains.d + frac * (tuned[k + 1].gains.d - tuned[k].gains.d);
+    return gains;
+}
+
+int
+main (void)
+{
+    tunedPoint_t tuned[MAX_TUNED];
+    char line[MAX_LINE];
+    int count = 0;
+    int k;
+
+    while ((count < MAX_TUNED) && fgets (line, sizeof (line), stdin)) {
+        tunedPoint_t *point = &tuned[count];
+        if (sscanf (line, "%lf,%lf,%lf,%lf", &point->altitude,
+                    &point->gains.p, &point->gains.i, &point->gains.d) == 4) {
+            count++;
+        }
+    }
+
+    if (count == 0) {
+        fprintf (stderr, "gaintable: no altitude,p,i,d lines read\n");
+        return 1;
+    }
+
+    qsort (tuned, count, sizeof (tuned[0]), compareAltitude);
+
+    printf ("static const gainSet_t g_altitudeGainPoints[GAIN_SCHEDULE_POINTS] = {\n");
+    for (k = 0; k < GAIN_SCHEDULE_POINTS; k++) {
+        const gainSet_t gains = interpolate (tuned, count, k * GAIN_SCHEDULE_STEP);
+        printf ("    {%.2f, %.2f, %.2f},\n", gains.p, gains.i, gains.d);
+    }
+    printf ("};\n");
+    return 0;
+}
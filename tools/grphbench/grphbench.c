@@ -0,0 +1,210 @@
+// *******************************************************
+//
+// grphbench.c
+//
+// Times the OrbitOledGrph drawing primitives on the host.
+// Each primitive is run many times into the frame buffer
+// and the mean time per call is printed. Nothing is sent
+// to the display, so only the drawing itself is measured.
+//
+// Build and run from the top of the repository with (one line):
+//
+//   gcc -O2 -DORBIT_OLED_HOST -I tools/oledemu -I . -o grphbench
+//       tools/grphbench/grphbench.c tools/oledemu/ssd1306.c
+//       tools/oledemu/tivahost.c OrbitOLED/lib_OrbitOled/*.c
+//   ./grphbench [calls per primitive]
+//
+// To compare against an older version of the drawing code,
+// build a second copy with that version of OrbitOledGrph.c
+// (from git show) in place of the current one.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "tivahost.h"
+#include "OrbitOLED/lib_OrbitOled/OrbitOled.h"
+#include "OrbitOLED/lib_OrbitOled/OrbitOledGrph.h"
+#include "OrbitOLED/lib_OrbitOled/FillPat.h"
+
+//*****************************************************************************
+//
+// Constants
+//
+//*****************************************************************************
+#define DEFAULT_CALLS 200000
+#define NS_PER_S 1000000000.0
+
+//*****************************************************************************
+//
+// Glyph used for the bitmap benchmarks
+//
+//*****************************************************************************
+static char g_glyph[8] = {0x3C, 0x42, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x00};
+
+
+//*****************************************************************************
+//
+// Primitives being timed. Each is called with an increasing count so the
+// position and colour move around and successive calls change the buffer.
+//
+//*****************************************************************************
+static void
+benchDrawPixel (uint32_t n)
+{
+    uint8_t column;
+
+    for (column = 0; column < ccolOledMax; column++) {
+        OrbitOledSetDrawColor ((n + column) & 1);
+        OrbitOledMoveTo (column, n & (crowOledMax - 1));
+        OrbitOledDrawPixel ();
+    }
+}
+
+static void
+benchFillFull (uint32_t n)
+{
+    OrbitOledSetFillPattern (OrbitOledGetStdPattern ((n & 1) ? iptnSolid : iptnBlank));
+    OrbitOledMoveTo (0, 0);
+    OrbitOledFillRect (ccolOledMax - 1, crowOledMax - 1);
+}
+
+static void
+benchFillSolid (uint32_t n)
+{
+    OrbitOledSetFillPattern (OrbitOledGetStdPattern ((n & 1) ? iptnSolid : iptnBlank));
+    OrbitOledMoveTo (10, 3);
+    OrbitOledFillRect (49, 15);
+}
+
+static void
+benchFillPattern (uint32_t n)
+{
+    OrbitOledSetFillPattern (OrbitOledGetStdPattern ((n & 1) ? iptnCross : iptnSpekOpen));
+    OrbitOledMoveTo (10, 3);
+    OrbitOledFillRect (49, 15);
+}
+
+static void
+benchBmpAligned (uint32_t n)
+{
+    g_glyph[7] = n;
+    OrbitOledMoveTo ((n & 15) * 8, (n & 3) * 8);
+    OrbitOledPutBmp (8, 8, g_glyph);
+}
+
+static void
+benchBmpUnaligned (uint32_t n)
+{
+    g_glyph[7] = n;
+    OrbitOledMoveTo ((n & 15) * 8, (n & 15) + 3);
+    OrbitOledPutBmp (8, 8, g_glyph);
+}
+
+static void
+benchLineHorizontal (uint32_t n)
+{
+    OrbitOledSetDrawColor (n & 1);
+    OrbitOledMoveTo (0, n & (crowOledMax - 1));
+    OrbitOledLineTo (ccolOledMax - 1, n & (crowOledMax - 1));
+}
+
+static void
+benchLineVertical (uint32_t n)
+{
+    OrbitOledSetDrawColor (n & 1);
+    OrbitOledMoveTo (n & (ccolOledMax - 1), 0);
+    OrbitOledLineTo (n & (ccolOledMax - 1), crowOledMax - 1);
+}
+
+static void
+benchDrawString (uint32_t n)
+{
+    OrbitOledMoveTo (0, (n & 1) * 8);
+    OrbitOledDrawString ((n & 2) ? "Alt: 100%" : "Yaw: -45 ");
+}
+
+//*****************************************************************************
+//
+// Runs a primitive the given number of times in each of the drawing modes it
+// is timed in and prints the mean time per call
+//
+//*****************************************************************************
+typedef struct {
+    const char *name;
+    void (*run)(uint32_t n);
+} bench_t;
+
+static const bench_t g_benches[] = {
+    {"DrawPixel x128",         benchDrawPixel},
+    {"FillRect 128x32 solid",  benchFillFull},
+    {"FillRect 40x13 solid",   benchFillSolid},
+    {"FillRect 40x13 pattern", benchFillPattern},
+    {"PutBmp 8x8 aligned",     benchBmpAligned},
+    {"PutBmp 8x8 unaligned",   benchBmpUnaligned},
+    {"LineTo horizontal",      benchLineHorizontal},
+    {"LineTo vertical",        benchLineVertical},
+    {"DrawString 9 chars",     benchDrawString},
+};
+
+static const struct {
+    const char *name;
+    int mode;
+} g_modes[] = {
+    {"set", modOledSet},
+    {"xor", modOledXor},
+};
+
+static double
+elapsedNs (const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * NS_PER_S + (now.tv_nsec - start->tv_nsec);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    const uint32_t calls = (argc > 1) ? strtoul (argv[1], NULL, 10) : DEFAULT_CALLS;
+    struct timespec start;
+    uint32_t bench;
+    uint32_t mode;
+    uint32_t n;
+
+    if (calls == 0) {
+        fprintf (stderr, "usage: grphbench [calls per primitive]\n");
+        return 1;
+    }
+
+    // Power the display up so the library is in the state the firmware uses
+    ssdInit ();
+    OrbitOledInit ();
+    hostRunPending ();
+
+    printf ("%-24s %10s %10s\n", "ns per call", g_modes[0].name, g_modes[1].name);
+    for (bench = 0; bench < sizeof(g_benches) / sizeof(g_benches[0]); bench++) {
+        printf ("%-24s", g_benches[bench].name);
+        for (mode = 0; mode < sizeof(g_modes) / sizeof(g_modes[0]); mode++) {
+            OrbitOledSetDrawMode (g_modes[mode].mode);
+            OrbitOledClearBuffer ();
+            clock_gettime (CLOCK_MONOTONIC, &start);
+            for (n = 0; n < calls; n++) {
+                g_benches[bench].run (n);
+            }
+            printf (" %10.1f", elapsedNs (&start) / calls);
+        }
+        printf ("\n");
+    }
+    return 0;
+}
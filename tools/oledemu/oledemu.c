@@ -0,0 +1,138 @@
+// *******************************************************
+//
+// oledemu.c
+//
+// Runs the display code on the host against the SSD1306 model and
+// saves every frame the controller ends up showing as a PBM image,
+// along with the SSI traffic it took to get there. Used to check
+// changes to the display rendering without the Orbit booster pack,
+// and to measure how many bytes a change to the display code saves.
+//
+// The display is taken through power up, a series of refreshes of
+// the values page, and then a run of strip chart samples. For each
+// frame it prints the command and data bytes, chip select
+// transactions and the time those bytes take on the 8 MHz SSI.
+//
+// Build and run from the top of the repository with (one line):
+//
+//   gcc -DORBIT_OLED_HOST -I tools/oledemu -I . -o oledemu
+//       tools/oledemu/*.c display.c OrbitOLED/OrbitOLEDInterface.c
+//       OrbitOLED/lib_OrbitOled/*.c -lm
+//   ./oledemu [output directory]
+//
+// Frames are written to the output directory (default: the current
+// directory) as frameNNN.pbm, drawn 4x size.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "ssd1306.h"
+#include "tivahost.h"
+#include "display.h"
+
+//*****************************************************************************
+//
+// Constants
+//
+//*****************************************************************************
+#define FRAME_SCALE 4
+#define VALUE_FRAMES 20
+#define CHART_FRAMES 160
+#define PATH_MAX_LENGTH 256
+#define PI 3.14159265
+
+//*****************************************************************************
+//
+// Running totals over all frames
+//
+//*****************************************************************************
+static uint16_t g_frameCount = 0;
+static ssdStats_t g_totals;
+
+
+//*****************************************************************************
+//
+// Lets the background display update finish, then saves the frame and prints
+// the traffic it took
+//
+//*****************************************************************************
+static bool
+finishFrame (const char *outDir, const char *label)
+{
+    char path[PATH_MAX_LENGTH];
+    uint32_t startUs = hostElapsedUs ();
+    ssdStats_t stats;
+
+    hostRunPending ();
+    stats = ssdGetStats ();
+    ssdResetStats ();
+
+    g_totals.cmdBytes += stats.cmdBytes;
+    g_totals.dataBytes += stats.dataBytes;
+    g_totals.transactions += stats.transactions;
+    g_totals.unknownCmds += stats.unknownCmds;
+
+    printf ("%3d %-8s cmd %4u data %4u cs %2u ssi %5u us%s\n",
+            g_frameCount, label, stats.cmdBytes, stats.dataBytes, stats.transactions,
+            hostElapsedUs () - startUs, ssdIsOn () ? "" : " (display off)");
+    if (stats.unknownCmds != 0) {
+        printf ("    %u unrecognised command bytes\n", stats.unknownCmds);
+    }
+
+    snprintf (path, sizeof(path), "%s/frame%03d.pbm", outDir, g_frameCount);
+    g_frameCount++;
+    if (!ssdWritePbm (path, FRAME_SCALE)) {
+        fprintf (stderr, "oledemu: can't write %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    const char *outDir = (argc > 1) ? argv[1] : ".";
+    uint16_t i;
+
+    ssdInit ();
+
+    // Power up and draw the labels
+    initDisplay ();
+    if (!finishFrame (outDir, "init")) {
+        return 1;
+    }
+
+    // Values page: a slow climb and turn, so only some digits change each time
+    for (i = 0; i < VALUE_FRAMES; i++) {
+        screenDisplay (i * 5, (double) (i * 17 % 360) - 180, 30 + i, 20 + (i & 3));
+        if (!finishFrame (outDir, "values")) {
+            return 1;
+        }
+    }
+
+    // Strip chart: an oscillating altitude and a decaying yaw error
+    toggleDisplayPage ();
+    if (!finishFrame (outDir, "toggle")) {
+        return 1;
+    }
+    for (i = 0; i < CHART_FRAMES; i++) {
+        int16_t altitude = 50 + 40 * sin (2 * PI * i / 64);
+        int16_t yawError = 40 * exp (-(double) i / 60) * cos (2 * PI * i / 20);
+        chartDisplay (altitude, yawError);
+        if (!finishFrame (outDir, "chart")) {
+            return 1;
+        }
+    }
+
+    printf ("total: %u frames, cmd %u data %u cs %u\n", g_frameCount,
+            g_totals.cmdBytes, g_totals.dataBytes, g_totals.transactions);
+    return 0;
+}
@@ -0,0 +1,332 @@
+// *******************************************************
+//
+// ssd1306.c
+//
+// Host model of the SSD1306 display controller on the Orbit
+// booster pack. Only the parts of the command set that affect
+// what ends up in display RAM are modelled: the addressing mode,
+// column and page addressing, and display on/off. Other commands
+// are recognised so their argument bytes are skipped, and anything
+// else is counted as unknown.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306.h"
+
+//*****************************************************************************
+//
+// Constants
+//
+//*****************************************************************************
+#define ADDR_MODE_HORIZONTAL 0
+#define ADDR_MODE_VERTICAL 1
+#define ADDR_MODE_PAGE 2
+#define CMD_ARGS_MAX 6
+
+//*****************************************************************************
+//
+// Controller state
+//
+//*****************************************************************************
+static uint8_t g_ram[SSD_PAGES][SSD_COLUMNS];
+static ssdStats_t g_stats;
+
+static bool g_selected;
+static bool g_data;
+static bool g_displayOn;
+
+static uint8_t g_addrMode;
+static uint8_t g_column;
+static uint8_t g_columnStart;
+static uint8_t g_columnEnd;
+static uint8_t g_page;
+static uint8_t g_pageStart;
+static uint8_t g_pageEnd;
+
+// A command that takes arguments is held here until they have all arrived
+static uint8_t g_cmd[CMD_ARGS_MAX + 1];
+static uint8_t g_cmdLength;
+static uint8_t g_cmdNeeded;
+
+
+//*****************************************************************************
+//
+// Returns the number of argument bytes that follow a command byte
+//
+//*****************************************************************************
+static uint8_t
+commandArgs (uint8_t cmd)
+{
+    switch (cmd) {
+        case 0x20:  // Memory addressing mode
+        case 0x81:  // Contrast
+        case 0x8D:  // Charge pump
+        case 0xA8:  // Multiplex ratio
+        case 0xD3:  // Display offset
+        case 0xD5:  // Clock divide
+        case 0xD9:  // Pre-charge period
+        case 0xDA:  // COM pins configuration
+        case 0xDB:  // VCOMH deselect level
+            return 1;
+        case 0x21:  // Column address range
+        case 0x22:  // Page address range
+        case 0xA3:  // Vertical scroll area
+            return 2;
+        case 0x29:  // Vertical and horizontal scroll setup
+        case 0x2A:
+            return 5;
+        case 0x26:  // Horizontal scroll setup
+        case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+
+//*****************************************************************************
+//
+// Reset the command state to its power on values
+//
+//*****************************************************************************
+static void
+resetRegisters (void)
+{
+    g_displayOn = false;
+    g_addrMode = ADDR_MODE_PAGE;
+    g_column = 0;
+    g_columnStart = 0;
+    g_columnEnd = SSD_COLUMNS - 1;
+    g_page = 0;
+    g_pageStart = 0;
+    g_pageEnd = SSD_PAGES - 1;
+    g_cmdLength = 0;
+    g_cmdNeeded = 0;
+}
+
+
+//*****************************************************************************
+//
+// Carry out a complete command held in g_cmd
+//
+//*****************************************************************************
+static void
+executeCommand (void)
+{
+    uint8_t cmd = g_cmd[0];
+
+    if (cmd <= 0x0F) {
+        g_column = (g_column & 0xF0) | cmd;
+    } else if (cmd <= 0x1F) {
+        g_column = ((cmd & 0x07) << 4) | (g_column & 0x0F);
+    } else if ((cmd >= 0xB0) && (cmd <= 0xB7)) {
+        g_page = cmd & 0x07;
+    } else if ((cmd >= 0x40) && (cmd <= 0x7F)) {
+        // Display start line, doesn't change display RAM
+    } else {
+        switch (cmd) {
+            case 0x20:
+                g_addrMode = g_cmd[1] & 0x03;
+                break;
+            case 0x21:
+                g_columnStart = g_cmd[1] & 0x7F;
+                g_columnEnd = g_cmd[2] & 0x7F;
+                g_column = g_columnStart;
+                break;
+            case 0x22:
+                // The datasheet only defines this for the horizontal and
+                // vertical modes, but the controller also moves the page
+                // pointer in page mode and the Orbit driver relies on it.
+                g_pageStart = g_cmd[1] & 0x07;
+                g_pageEnd = g_cmd[2] & 0x07;
+                g_page = g_pageStart;
+                break;
+            case 0xAE:
+                g_displayOn = false;
+                break;
+            case 0xAF:
+                g_displayOn = true;
+                break;
+            case 0x81: case 0x8D: case 0xA0: case 0xA1: case 0xA3:
+            case 0xA4: case 0xA5: case 0xA6: case 0xA7: case 0xA8:
+            case 0xC0: case 0xC8: case 0xD3: case 0xD5: case 0xD9:
+            case 0xDA: case 0xDB: case 0xE3: case 0x26: case 0x27:
+            case 0x29: case 0x2A: case 0x2E: case 0x2F:
+                // Timing, orientation and scrolling settings. The image is
+                // saved in display RAM order, which is how the Orbit driver
+                // lays out its frame buffer.
+                break;
+            default:
+                g_stats.unknownCmds++;
+                break;
+        }
+    }
+}
+
+
+//*****************************************************************************
+//
+// Store one byte of display data and advance the RAM pointers as the current
+// addressing mode does
+//
+//*****************************************************************************
+static void
+writeData (uint8_t byte)
+{
+    g_ram[g_page][g_column] = byte;
+
+    switch (g_addrMode) {
+        case ADDR_MODE_HORIZONTAL:
+            if (g_column >= g_columnEnd) {
+                g_column = g_columnStart;
+                g_page = (g_page >= g_pageEnd) ? g_pageStart : g_page + 1;
+            } else {
+                g_column++;
+            }
+            break;
+        case ADDR_MODE_VERTICAL:
+            if (g_page >= g_pageEnd) {
+                g_page = g_pageStart;
+                g_column = (g_column >= g_columnEnd) ? g_columnStart : g_column + 1;
+            } else {
+                g_page++;
+            }
+            break;
+        default:
+            g_column = (g_column + 1) & (SSD_COLUMNS - 1);
+            break;
+    }
+}
+
+
+void
+ssdInit (void)
+{
+    memset (g_ram, 0, sizeof(g_ram));
+    memset (&g_stats, 0, sizeof(g_stats));
+    g_selected = false;
+    g_data = false;
+    resetRegisters ();
+}
+
+
+void
+ssdSetReset (bool level)
+{
+    if (!level) {
+        resetRegisters ();
+    }
+}
+
+
+void
+ssdSetSelect (bool level)
+{
+    bool selected = !level;
+
+    if (selected && !g_selected) {
+        g_stats.transactions++;
+    }
+    g_selected = selected;
+}
+
+
+void
+ssdSetDataCmd (bool level)
+{
+    g_data = level;
+}
+
+
+void
+ssdWrite (uint8_t byte)
+{
+    if (!g_selected) {
+        return;
+    }
+
+    if (g_data) {
+        g_stats.dataBytes++;
+        writeData (byte);
+        return;
+    }
+
+    g_stats.cmdBytes++;
+    if (g_cmdNeeded == 0) {
+        g_cmd[0] = byte;
+        g_cmdLength = 1;
+        g_cmdNeeded = commandArgs (byte);
+    } else {
+        g_cmd[g_cmdLength++] = byte;
+        g_cmdNeeded--;
+    }
+
+    if (g_cmdNeeded == 0) {
+        executeCommand ();
+    }
+}
+
+
+bool
+ssdGetPixel (uint8_t column, uint8_t row)
+{
+    return (g_ram[row / 8][column] >> (row & 0x07)) & 0x01;
+}
+
+
+bool
+ssdIsOn (void)
+{
+    return g_displayOn;
+}
+
+
+bool
+ssdWritePbm (const char *path, uint8_t scale)
+{
+    FILE *file = fopen (path, "wb");
+    uint16_t width = SSD_COLUMNS * scale;
+    uint16_t height = SSD_PANEL_PAGES * 8 * scale;
+    uint16_t x;
+    uint16_t y;
+
+    if (file == NULL) {
+        return false;
+    }
+
+    // P4 rows are packed 8 pixels to a byte, most significant bit first,
+    // with 1 meaning black. Lit pixels are drawn black on white.
+    fprintf (file, "P4\n%d %d\n", width, height);
+    for (y = 0; y < height; y++) {
+        uint8_t packed = 0;
+        for (x = 0; x < width; x++) {
+            packed = (packed << 1) | ssdGetPixel (x / scale, y / scale);
+            if ((x & 0x07) == 0x07) {
+                fputc (packed, file);
+                packed = 0;
+            }
+        }
+    }
+
+    return fclose (file) == 0;
+}
+
+
+ssdStats_t
+ssdGetStats (void)
+{
+    return g_stats;
+}
+
+
+void
+ssdResetStats (void)
+{
+    memset (&g_stats, 0, sizeof(g_stats));
+}
@@ -0,0 +1,124 @@
+// *******************************************************
+//
+// ssd1306.h
+//
+// Host model of the SSD1306 display controller on the Orbit
+// booster pack. Bytes clocked in over the SSI are decoded as
+// commands or display data according to the D/C line and written
+// into a copy of the controller's display RAM, which can then be
+// saved as an image. Bytes and chip select transactions are
+// counted so the display traffic of a frame can be measured.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#ifndef SSD1306_H_
+#define SSD1306_H_
+
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+// Constants
+//
+//*****************************************************************************
+#define SSD_COLUMNS 128
+#define SSD_PAGES 8         // Pages in the controller's display RAM
+#define SSD_PANEL_PAGES 4   // Pages visible on the 128x32 Orbit panel
+
+//*****************************************************************************
+//
+// Traffic counters. Cleared by ssdResetStats.
+//
+//*****************************************************************************
+typedef struct {
+    uint32_t cmdBytes;      // Bytes sent with D/C low
+    uint32_t dataBytes;     // Bytes sent with D/C high
+    uint32_t transactions;  // Chip select assertions
+    uint32_t unknownCmds;   // Command bytes the model doesn't recognise
+} ssdStats_t;
+
+//*****************************************************************************
+//
+// ssdInit: Put the model into its power on state with cleared display RAM
+//
+//*****************************************************************************
+void
+ssdInit (void);
+
+//*****************************************************************************
+//
+// ssdSetReset: Drive the active low reset line. Holding it low puts the
+// command state back to its reset values; display RAM is kept.
+//
+//*****************************************************************************
+void
+ssdSetReset (bool level);
+
+//*****************************************************************************
+//
+// ssdSetSelect: Drive the active low chip select line. Bytes are only
+// accepted while it is low.
+//
+//*****************************************************************************
+void
+ssdSetSelect (bool level);
+
+//*****************************************************************************
+//
+// ssdSetDataCmd: Drive the D/C line; high for display data, low for commands
+//
+//*****************************************************************************
+void
+ssdSetDataCmd (bool level);
+
+//*****************************************************************************
+//
+// ssdWrite: Clock one byte into the controller
+//
+//*****************************************************************************
+void
+ssdWrite (uint8_t byte);
+
+//*****************************************************************************
+//
+// ssdGetPixel: Returns the display RAM bit for a pixel, row 0 at the top
+//
+//*****************************************************************************
+bool
+ssdGetPixel (uint8_t column, uint8_t row);
+
+//*****************************************************************************
+//
+// ssdIsOn: Returns true once the display on command has been received
+//
+//*****************************************************************************
+bool
+ssdIsOn (void);
+
+//*****************************************************************************
+//
+// ssdWritePbm: Saves the visible part of display RAM as a binary PBM image,
+// scaled up by an integer factor. Returns false if the file can't be written.
+//
+//*****************************************************************************
+bool
+ssdWritePbm (const char *path, uint8_t scale);
+
+//*****************************************************************************
+//
+// ssdGetStats / ssdResetStats: Read and clear the traffic counters
+//
+//*****************************************************************************
+ssdStats_t
+ssdGetStats (void);
+
+void
+ssdResetStats (void);
+
+#endif /*SSD1306_H_*/
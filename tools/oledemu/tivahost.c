@@ -0,0 +1,240 @@
+// *******************************************************
+//
+// tivahost.c
+//
+// Host implementation of the TivaWare calls used by the Orbit
+// OLED library. The display control lines (D/C on PD7, CS on PD1,
+// reset on PE5) and every byte written to SSI3, whether through
+// SSIDataPut or a uDMA transfer, go to the SSD1306 model. A uDMA
+// transfer completes as soon as it is enabled and a Timer 1
+// one-shot expires as soon as it is started; their interrupt
+// handlers are left pending until hostRunPending is called, the
+// same way the firmware's handlers run after the code that
+// started them has returned.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include "tivahost.h"
+#include "ssd1306.h"
+
+//*****************************************************************************
+//
+// Constants
+//
+//*****************************************************************************
+#define HOST_CLOCK_HZ 20000000
+#define HOST_REGISTERS 64
+
+//*****************************************************************************
+//
+// Peripheral state
+//
+//*****************************************************************************
+static volatile uint32_t g_registers[HOST_REGISTERS];
+static uint64_t g_elapsedNs;
+
+static void (*g_ssiHandler)(void);
+static uint32_t g_ssiBitRate = 8000000;
+static bool g_ssiIntPending;
+
+static void (*g_timerHandler)(void);
+static uint32_t g_timerConfig;
+static uint32_t g_timerLoad;
+static bool g_timerIntEnabled;
+static bool g_timerIntPending;
+
+static uint8_t *g_dmaSource;
+static uint32_t g_dmaCount;
+
+
+//*****************************************************************************
+//
+// Send one byte to the model and account for its time on the wire
+//
+//*****************************************************************************
+static void
+ssiShiftOut (uint8_t byte)
+{
+    ssdWrite (byte);
+    g_elapsedNs += (8 * 1000000000ULL) / g_ssiBitRate;
+}
+
+
+volatile uint32_t *
+hostRegister (uint32_t address)
+{
+    return &g_registers[(address >> 2) % HOST_REGISTERS];
+}
+
+
+void GPIOPinConfigure (uint32_t ui32PinConfig) { }
+void GPIOPinTypeGPIOOutput (uint32_t ui32Port, uint8_t ui8Pins) { }
+void GPIOPinTypeSSI (uint32_t ui32Port, uint8_t ui8Pins) { }
+
+void
+GPIOPinWrite (uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val)
+{
+    if (ui32Port == GPIO_PORTD_BASE) {
+        if (ui8Pins & GPIO_PIN_7) {
+            ssdSetDataCmd ((ui8Val & GPIO_PIN_7) != 0);
+        }
+        if (ui8Pins & GPIO_PIN_1) {
+            ssdSetSelect ((ui8Val & GPIO_PIN_1) != 0);
+        }
+    } else if (ui32Port == GPIO_PORTE_BASE) {
+        if (ui8Pins & GPIO_PIN_5) {
+            ssdSetReset ((ui8Val & GPIO_PIN_5) != 0);
+        }
+    }
+}
+
+
+void IntPrioritySet (uint32_t ui32Interrupt, uint8_t ui8Priority) { }
+
+
+bool SSIBusy (uint32_t ui32Base) { return false; }
+void SSIClockSourceSet (uint32_t ui32Base, uint32_t ui32Source) { }
+void SSIDMAEnable (uint32_t ui32Base, uint32_t ui32DMAFlags) { }
+void SSIEnable (uint32_t ui32Base) { }
+void SSIIntClear (uint32_t ui32Base, uint32_t ui32IntFlags) { }
+uint32_t SSIIntStatus (uint32_t ui32Base, bool bMasked) { return 0; }
+
+void
+SSIConfigSetExpClk (uint32_t ui32Base, uint32_t ui32SSIClk, uint32_t ui32Protocol,
+                    uint32_t ui32Mode, uint32_t ui32BitRate, uint32_t ui32DataWidth)
+{
+    g_ssiBitRate = ui32BitRate;
+}
+
+void
+SSIDataPut (uint32_t ui32Base, uint32_t ui32Data)
+{
+    ssiShiftOut ((uint8_t) ui32Data);
+}
+
+int32_t
+SSIDataGetNonBlocking (uint32_t ui32Base, uint32_t *pui32Data)
+{
+    return 0;
+}
+
+void
+SSIIntRegister (uint32_t ui32Base, void (*pfnHandler)(void))
+{
+    g_ssiHandler = pfnHandler;
+}
+
+
+uint32_t SysCtlClockGet (void) { return HOST_CLOCK_HZ; }
+void SysCtlPeripheralEnable (uint32_t ui32Peripheral) { }
+
+
+void
+TimerConfigure (uint32_t ui32Base, uint32_t ui32Config)
+{
+    g_timerConfig = ui32Config;
+}
+
+void TimerDisable (uint32_t ui32Base, uint32_t ui32Timer) { }
+
+void
+TimerEnable (uint32_t ui32Base, uint32_t ui32Timer)
+{
+    if ((g_timerConfig == TIMER_CFG_ONE_SHOT) && g_timerIntEnabled) {
+        g_timerIntPending = true;
+    }
+}
+
+void
+TimerIntClear (uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    g_timerIntPending = false;
+}
+
+void
+TimerIntDisable (uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    g_timerIntEnabled = false;
+}
+
+void
+TimerIntEnable (uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    g_timerIntEnabled = true;
+}
+
+void
+TimerIntRegister (uint32_t ui32Base, uint32_t ui32Timer, void (*pfnHandler)(void))
+{
+    g_timerHandler = pfnHandler;
+}
+
+void
+TimerLoadSet (uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value)
+{
+    g_timerLoad = ui32Value;
+}
+
+uint32_t
+TimerValueGet (uint32_t ui32Base, uint32_t ui32Timer)
+{
+    // DelayMs polls this; let every poll look like a millisecond has passed
+    HWREG (ui32Base + TIMER_O_TAV) += HOST_CLOCK_HZ / 1000;
+    g_elapsedNs += 1000000;
+    return HWREG (ui32Base + TIMER_O_TAV);
+}
+
+
+void uDMAChannelAssign (uint32_t ui32Mapping) { }
+void uDMAChannelAttributeDisable (uint32_t ui32ChannelNum, uint32_t ui32Attr) { }
+void uDMAChannelControlSet (uint32_t ui32ChannelStructIndex, uint32_t ui32Control) { }
+void uDMAControlBaseSet (void *pControlTable) { }
+void uDMAEnable (void) { }
+bool uDMAChannelIsEnabled (uint32_t ui32ChannelNum) { return false; }
+
+void
+uDMAChannelTransferSet (uint32_t ui32ChannelStructIndex, uint32_t ui32Mode,
+                        void *pvSrcAddr, void *pvDstAddr, uint32_t ui32TransferSize)
+{
+    g_dmaSource = pvSrcAddr;
+    g_dmaCount = ui32TransferSize;
+}
+
+void
+uDMAChannelEnable (uint32_t ui32ChannelNum)
+{
+    while (g_dmaCount > 0) {
+        ssiShiftOut (*g_dmaSource++);
+        g_dmaCount--;
+    }
+    g_ssiIntPending = true;
+}
+
+
+void
+hostRunPending (void)
+{
+    while (true) {
+        if (g_ssiIntPending && (g_ssiHandler != 0)) {
+            g_ssiIntPending = false;
+            g_ssiHandler ();
+        } else if (g_timerIntPending && g_timerIntEnabled && (g_timerHandler != 0)) {
+            g_timerIntPending = false;
+            g_elapsedNs += (uint64_t) g_timerLoad * 1000 / (HOST_CLOCK_HZ / 1000000);
+            g_timerHandler ();
+        } else {
+            return;
+        }
+    }
+}
+
+
+uint32_t
+hostElapsedUs (void)
+{
+    return g_elapsedNs / 1000;
+}
@@ -0,0 +1,155 @@
+// *******************************************************
+//
+// tivahost.h
+//
+// Stand-in for the TivaWare headers used by the Orbit OLED library
+// when it is built on the host. LaunchPad.h includes this instead
+// of the real headers when ORBIT_OLED_HOST is defined. Only the
+// constants and driverlib calls the library uses are provided; the
+// calls that drive the display lines and the SSI are passed on to
+// the SSD1306 model, and interrupts are run from hostRunPending.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#ifndef TIVAHOST_H_
+#define TIVAHOST_H_
+
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+// Register access. Writes land in a scratch array, nothing is decoded.
+//
+//*****************************************************************************
+#define HWREG(x) (*hostRegister (x))
+
+volatile uint32_t *
+hostRegister (uint32_t address);
+
+//*****************************************************************************
+//
+// Memory map, interrupt and peripheral constants (values as in TivaWare)
+//
+//*****************************************************************************
+#define GPIO_PORTA_BASE 0x40004000
+#define GPIO_PORTB_BASE 0x40005000
+#define GPIO_PORTC_BASE 0x40006000
+#define GPIO_PORTD_BASE 0x40007000
+#define GPIO_PORTE_BASE 0x40024000
+#define GPIO_PORTF_BASE 0x40025000
+#define SSI3_BASE 0x4000B000
+#define TIMER1_BASE 0x40031000
+
+#define GPIO_PIN_0 0x00000001
+#define GPIO_PIN_1 0x00000002
+#define GPIO_PIN_2 0x00000004
+#define GPIO_PIN_3 0x00000008
+#define GPIO_PIN_4 0x00000010
+#define GPIO_PIN_5 0x00000020
+#define GPIO_PIN_6 0x00000040
+#define GPIO_PIN_7 0x00000080
+#define GPIO_O_LOCK 0x00000520
+#define GPIO_O_CR 0x00000524
+
+#define INT_SSI3 73
+#define INT_TIMER1A 37
+
+#define SYSCTL_PERIPH_GPIOD 0xf0000803
+#define SYSCTL_PERIPH_GPIOE 0xf0000804
+#define SYSCTL_PERIPH_SSI3 0xf0001c03
+#define SYSCTL_PERIPH_TIMER1 0xf0000401
+#define SYSCTL_PERIPH_UDMA 0xf0000c00
+
+#define SSI_O_DR 0x00000008
+#define SSI_CLOCK_SYSTEM 0x00000000
+#define SSI_FRF_MOTO_MODE_0 0x00000000
+#define SSI_MODE_MASTER 0x00000000
+#define SSI_DMA_TX 0x00000002
+
+#define TIMER_A 0x000000ff
+#define TIMER_CFG_ONE_SHOT 0x00000021
+#define TIMER_CFG_PERIODIC_UP 0x00000032
+#define TIMER_TIMA_TIMEOUT 0x00000001
+#define TIMER_O_TAV 0x00000050
+
+#define UDMA_CH15_SSI3TX 0x0002000f
+#define UDMA_ATTR_ALL 0x0000000f
+#define UDMA_PRI_SELECT 0x00000000
+#define UDMA_SIZE_8 0x00000000
+#define UDMA_SRC_INC_8 0x00000000
+#define UDMA_DST_INC_NONE 0xc0000000
+#define UDMA_ARB_4 0x00008000
+#define UDMA_MODE_BASIC 0x00000001
+
+//*****************************************************************************
+//
+// driverlib calls used by the Orbit OLED library
+//
+//*****************************************************************************
+void GPIOPinConfigure (uint32_t ui32PinConfig);
+void GPIOPinTypeGPIOOutput (uint32_t ui32Port, uint8_t ui8Pins);
+void GPIOPinTypeSSI (uint32_t ui32Port, uint8_t ui8Pins);
+void GPIOPinWrite (uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val);
+
+void IntPrioritySet (uint32_t ui32Interrupt, uint8_t ui8Priority);
+
+bool SSIBusy (uint32_t ui32Base);
+void SSIClockSourceSet (uint32_t ui32Base, uint32_t ui32Source);
+void SSIConfigSetExpClk (uint32_t ui32Base, uint32_t ui32SSIClk, uint32_t ui32Protocol,
+                         uint32_t ui32Mode, uint32_t ui32BitRate, uint32_t ui32DataWidth);
+void SSIDMAEnable (uint32_t ui32Base, uint32_t ui32DMAFlags);
+void SSIDataPut (uint32_t ui32Base, uint32_t ui32Data);
+int32_t SSIDataGetNonBlocking (uint32_t ui32Base, uint32_t *pui32Data);
+void SSIEnable (uint32_t ui32Base);
+void SSIIntClear (uint32_t ui32Base, uint32_t ui32IntFlags);
+void SSIIntRegister (uint32_t ui32Base, void (*pfnHandler)(void));
+uint32_t SSIIntStatus (uint32_t ui32Base, bool bMasked);
+
+uint32_t SysCtlClockGet (void);
+void SysCtlPeripheralEnable (uint32_t ui32Peripheral);
+
+void TimerConfigure (uint32_t ui32Base, uint32_t ui32Config);
+void TimerDisable (uint32_t ui32Base, uint32_t ui32Timer);
+void TimerEnable (uint32_t ui32Base, uint32_t ui32Timer);
+void TimerIntClear (uint32_t ui32Base, uint32_t ui32IntFlags);
+void TimerIntDisable (uint32_t ui32Base, uint32_t ui32IntFlags);
+void TimerIntEnable (uint32_t ui32Base, uint32_t ui32IntFlags);
+void TimerIntRegister (uint32_t ui32Base, uint32_t ui32Timer, void (*pfnHandler)(void));
+void TimerLoadSet (uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value);
+uint32_t TimerValueGet (uint32_t ui32Base, uint32_t ui32Timer);
+
+void uDMAChannelAssign (uint32_t ui32Mapping);
+void uDMAChannelAttributeDisable (uint32_t ui32ChannelNum, uint32_t ui32Attr);
+void uDMAChannelControlSet (uint32_t ui32ChannelStructIndex, uint32_t ui32Control);
+void uDMAChannelEnable (uint32_t ui32ChannelNum);
+bool uDMAChannelIsEnabled (uint32_t ui32ChannelNum);
+void uDMAChannelTransferSet (uint32_t ui32ChannelStructIndex, uint32_t ui32Mode,
+                             void *pvSrcAddr, void *pvDstAddr, uint32_t ui32TransferSize);
+void uDMAControlBaseSet (void *pControlTable);
+void uDMAEnable (void);
+
+//*****************************************************************************
+//
+// hostRunPending: Runs the interrupt handlers for any timer timeout or uDMA
+// completion that has happened, until nothing is left pending. Call this in
+// place of the main loop waiting for interrupts.
+//
+//*****************************************************************************
+void
+hostRunPending (void);
+
+//*****************************************************************************
+//
+// hostElapsedUs: Simulated time spent in timer delays and on the SSI, in us
+//
+//*****************************************************************************
+uint32_t
+hostElapsedUs (void);
+
+#endif /*TIVAHOST_H_*/
@@ -0,0 +1,89 @@
+// *******************************************************
+//
+// trajectory.c
+//
+// Set point profiles. Each step works out the fastest speed
+// from which the reference could still stop at the target
+// within the acceleration limit, caps it at the speed
+// limit, and moves the velocity towards that by no more
+// than the acceleration limit allows. That gives a
+// trapezoidal profile which also copes with the target
+// moving part way through.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#include <stdint.h>
+#include <math.h>
+#include <stdbool.h>
+#include "trajectory.h"
+
+// *******************************************************
+//
+// Brings a distance or position into -wrap/2 to wrap/2
+//
+// *******************************************************
+static double
+wrapValue (double value, double wrap)
+{
+    if (wrap != 0) {
+        if (value > wrap / 2) {
+            value -= wrap;
+        } else if (value <= -wrap / 2) {
+            value += wrap;
+        }
+    }
+    return value;
+}
+
+
+void
+trajectoryReset (trajectory_t *traj, double position)
+{
+    traj->position = position;
+    traj->velocity = 0;
+}
+
+
+double
+trajectoryStep (trajectory_t *traj, double target, double dt)
+{
+    const double distance = wrapValue (target - traj->position, traj->wrap);
+    const double accelStep = traj->maxAccel * dt;
+    const float maxVelocity = (float) traj->maxVelocity;
+    float stopSquared;
+    double wanted;
+
+    // Fastest speed towards the target that can still stop on it. The FPU is
+    // single precision, so this is squared and compared with the speed limit
+    // in float and only rooted while the reference is slowing for the target.
+    stopSquared = 2.0f * (float) traj->maxAccel * fabsf ((float) distance);
+    if (stopSquared >= maxVelocity * maxVelocity) {
+        wanted = traj->maxVelocity;
+    } else {
+        wanted = sqrtf (stopSquared);
+    }
+    if (distance < 0) {
+        wanted = -wanted;
+    }
+
+    if (wanted > traj->velocity + accelStep) {
+        traj->velocity += accelStep;
+    } else if (wanted < traj->velocity - accelStep) {
+        traj->velocity -= accelStep;
+    } else {
+        traj->velocity = wanted;
+    }
+
+    // Stop on the target rather than stepping past it
+    if (fabs (distance) <= fabs (traj->velocity) * dt) {
+        traj->position = target;
+        traj->velocity = 0;
+    } else {
+        traj->position = wrapValue (traj->position + traj->velocity * dt, traj->wrap);
+    }
+    return traj->position;
+}
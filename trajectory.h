@@ -0,0 +1,59 @@
+// *******************************************************
+//
+// trajectory.h
+//
+// Set point profiles. A change of set point is turned into
+// a trapezoidal profile: the reference accelerates at a
+// limited rate, moves at a limited speed, and decelerates
+// to stop on the new set point. The controllers follow the
+// reference rather than jumping to the set point.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+#ifndef TRAJECTORY_H_
+#define TRAJECTORY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// *******************************************************
+//
+// Constants
+//
+// *******************************************************
+#define TRAJ_ALT_MAX_RATE 25    // Altitude, % per s
+#define TRAJ_ALT_MAX_ACCEL 50   // Altitude, % per s^2
+#define TRAJ_YAW_MAX_RATE 90    // Yaw, degrees per s
+#define TRAJ_YAW_MAX_ACCEL 180  // Yaw, degrees per s^2
+
+// One profiled reference
+typedef struct {
+    double position;    // Reference now
+    double velocity;    // Rate of change of the reference, per s
+    double maxVelocity;
+    double maxAccel;
+    double wrap;        // Range the reference wraps over, 0 if it doesn't
+} trajectory_t;
+
+// *******************************************************
+//
+// Puts the reference at a position, at rest
+//
+// *******************************************************
+void
+trajectoryReset (trajectory_t *traj, double position);
+
+// *******************************************************
+//
+// Moves the reference dt seconds along the profile towards
+// the target and returns it. Called each control tick.
+//
+// *******************************************************
+double
+trajectoryStep (trajectory_t *traj, double target, double dt);
+
+#endif /* TRAJECTORY_H_ */
@@ -1,82 +1,115 @@
-// *******************************************************
-//
-// uart.c
-//
-// UART code is set to output to a port.
-// Code modified from lab code.
-//
-// Authors: Luke Roeven (ljr83)
-//          Anahita Piri (api48)
-//          Maggie Booker (meb139)
-//
-// *******************************************************
-
-
-#include <stdint.h>
-#include <math.h>
-#include <stdbool.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include "inc/hw_memmap.h"
-#include "inc/hw_types.h"
-#include "inc/hw_ints.h"
-#include "driverlib/pin_map.h" //Needed for pin configure
-#include "driverlib/gpio.h"
-#include "driverlib/uart.h"
-#include "driverlib/sysctl.h"
-#include "uart.h"
-
-//*****************************************************************************
-//
-// Global variables
-//
-//*****************************************************************************
-
-char g_statusStr[MAX_STR_LEN + 1];
-
-//********************************************************
-//
-// initialiseUSB_UART - 8 bits, 1 stop bit, no parity
-//
-//********************************************************
-void
-initialiseUSB_UART (void)
-{
-    //
-    // Enable GPIO port A which is used for UART0 pins.
-    //
-    SysCtlPeripheralEnable(UART_USB_PERIPH_UART);
-    SysCtlPeripheralEnable(UART_USB_PERIPH_GPIO);
-    //
-    // Select the alternate (UART) function for these pins.
-    //
-    GPIOPinTypeUART(UART_USB_GPIO_BASE, UART_USB_GPIO_PINS);
-    GPIOPinConfigure (GPIO_PA0_U0RX);
-    GPIOPinConfigure (GPIO_PA1_U0TX);
-
-    UARTConfigSetExpClk(UART_USB_BASE, SysCtlClockGet(), BAUD_RATE,
-            UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
-            UART_CONFIG_PAR_NONE);
-    UARTFIFOEnable(UART_USB_BASE);
-    UARTEnable(UART_USB_BASE);
-}
-
-
-//**********************************************************************
-//
-// Transmit a string via UART0
-//
-//**********************************************************************
-void
-UARTSend (char *pucBuffer)
-{
-    // Loop while there are more characters to send.
-    while(*pucBuffer)
-    {
-        // Write the next character to the UART Tx FIFO.
-        UARTCharPut(UART_USB_BASE, *pucBuffer);
-        pucBuffer++;
-    }
-}
-
-
+// *******************************************************
+//
+// uart.c
+//
+// UART code is set to output to a port.
+// Code modified from lab code.
+//
+// Authors: Luke Roeven (ljr83)
+//          Anahita Piri (api48)
+//          Maggie Booker (meb139)
+//
+// *******************************************************
+
+
+#include <stdint.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "driverlib/pin_map.h" //Needed for pin configure
+#include "driverlib/gpio.h"
+#include "driverlib/uart.h"
+#include "driverlib/sysctl.h"
+#include "uart.h"
+
+//*****************************************************************************
+//
+// Global variables
+//
+//*****************************************************************************
+
+char g_statusStr[MAX_STR_LEN + 1];
+
+//********************************************************
+//
+// initialiseUSB_UART - 8 bits, 1 stop bit, no parity
+//
+//********************************************************
+void
+initialiseUSB_UART (void)
+{
+    //
+    // Enable GPIO port A which is used for UART0 pins.
+    //
+    SysCtlPeripheralEnable(UART_USB_PERIPH_UART);
+    SysCtlPeripheralEnable(UART_USB_PERIPH_GPIO);
+    //
+    // Select the alternate (UART) function for these pins.
+    //
+    GPIOPinTypeUART(UART_USB_GPIO_BASE, UART_USB_GPIO_PINS);
+    GPIOPinConfigure (GPIO_PA0_U0RX);
+    GPIOPinConfigure (GPIO_PA1_U0TX);
+
+    UARTConfigSetExpClk(UART_USB_BASE, SysCtlClockGet(), BAUD_RATE,
+            UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
+            UART_CONFIG_PAR_NONE);
+    UARTFIFOEnable(UART_USB_BASE);
+    UARTEnable(UART_USB_BASE);
+}
+
+
+//**********************************************************************
+//
+// Transmit a string via UART0
+//
+//**********************************************************************
+void
+UARTSend (char *pucBuffer)
+{
+    // Loop while there are more characters to send.
+    while(*pucBuffer)
+    {
+        // Write the next character to the UART Tx FIFO.
+        UARTCharPut(UART_USB_BASE, *pucBuffer);
+        pucBuffer++;
+    }
+}
+
+
+//**********************************************************************
+//
+// Collect received characters into a line without waiting. Returns
+// true when a carriage return or line feed ends a non-empty line,
+// which is then in pucLine with a terminating zero. The same buffer
+// must be passed on every call; characters that don't fit are dropped.
+//
+//**********************************************************************
+bool
+UARTReadLine (char *pucLine, uint32_t ui32Size)
+{
+    static uint32_t ui32Len = 0;
+    char cChar;
+
+    while (UARTCharsAvail(UART_USB_BASE))
+    {
+        cChar = UARTCharGetNonBlocking(UART_USB_BASE);
+        if ((cChar == '\r') || (cChar == '\n'))
+        {
+            if (ui32Len > 0)
+            {
+                pucLine[ui32Len] = '\0';
+                ui32Len = 0;
+                return true;
+            }
+        }
+        else if (ui32Len < ui32Size - 1)
+        {
+            pucLine[ui32Len++] = cChar;
+        }
+    }
+    return false;
+}